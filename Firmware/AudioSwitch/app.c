@@ -5,6 +5,10 @@
 #include "app.h"
 #include "app_funcs.h"
 #include "app_ios_and_regs.h"
+#include "app_events.h"
+#include "app_sequence.h"
+#include "app_sweep.h"
+#include "app_sync.h"
 
 /************************************************************************/
 /* Declare application registers                                        */
@@ -77,13 +81,149 @@ void core_callback_reset_registers(void)
    app_regs.REG_DO = 0;
    app_regs.REG_DI4_CONF = GM_DI4_ADDRESS;
    app_regs.REG_DO0_CONF = GM_DO_TGL_WHEN_CH_SEL_CHANGE;
-   app_regs.REG_EVNT_ENABLE = B_EVT_OUTPUT_CHANNEL | B_EVT_DI_STATE;
+   app_regs.REG_EVNT_ENABLE = B_EVT_OUTPUT_CHANNEL | B_EVT_DI_STATE | B_EVT_COALESCED_EDGES;
+   app_regs.REG_SWITCH_POLICY = GM_SWITCH_SIMULTANEOUS;
+   app_regs.REG_SWITCH_DEAD_TIME = 100;
+   app_regs.REG_INPUTS_PRIORITY = GM_INPUTS_PRIORITY_LOW;
+   app_regs.REG_EVT_QUEUE_OVERFLOWS = 0;
+   app_regs.REG_EVT_COALESCE_WINDOW = 0;
+   app_regs.REG_EVT_COALESCED_EDGES[0] = 0;
+   app_regs.REG_EVT_COALESCED_EDGES[1] = 0;
+   app_regs.REG_EVT_COALESCED_EDGES[2] = 0;
+   app_regs.REG_IO_STATE = 0;
+   app_regs.REG_SEQ_APPEND[0] = 0;
+   app_regs.REG_SEQ_APPEND[1] = 0;
+   app_regs.REG_SEQ_APPEND[2] = 0;
+   app_regs.REG_SEQ_APPEND[3] = 0;
+   app_regs.REG_SEQ_CONTROL = GM_SEQ_STOP;
+   app_regs.REG_SEQ_STATUS = 0;
+   app_regs.REG_SEQ_UNDERRUNS = 0;
+   app_regs.REG_ARMED_MASK = 0;
+   app_regs.REG_ARM_TRIGGER = GM_ARM_EDGE_RISING;
+   app_regs.REG_CHANNEL_SET = 0;
+   app_regs.REG_CHANNEL_CLEAR = 0;
+   app_regs.REG_CHANNEL_TOGGLE = 0;
+   app_regs.REG_GATE_INPUTS = B_DI0;
+   app_regs.REG_SWEEP_CHANNELS = 0xFFFF;
+   app_regs.REG_SWEEP_DWELL = 1000000;
+   app_regs.REG_SWEEP_ORDER = GM_SWEEP_SEQUENTIAL;
+   app_regs.REG_SWEEP_SEED = 1;
+   app_regs.REG_SWEEP_REPEATS = 1;
+   app_regs.REG_SWEEP_CONTROL = GM_SWEEP_STOP;
+   app_regs.REG_DO0_PULSE_WIDTH = 100;
+   app_regs.REG_DO0_CODE_UNIT = 50;
+   app_regs.REG_DEGLITCH_TIME = 0;
+   app_regs.REG_STREAM_KEEPALIVE = 100;
+   app_regs.REG_EDGE_HEAD = 0;
+   app_regs.REG_EDGE_TAIL = 0;
+   
+   for (uint8_t i = 0; i < 32; i++)
+      app_regs.REG_EDGE_HISTORY[i] = 0;
+   
+   app_regs.REG_LATENCY_CLEAR = 0;
+   
+   for (uint8_t i = 0; i < 16; i++)
+   {
+      app_regs.REG_LATENCY_EXTERNAL[i] = 0;
+      app_regs.REG_LATENCY_USB[i] = 0;
+   }
+   
+   for (uint8_t i = 0; i < 16; i++)
+   {
+      app_regs.REG_CHANNEL_ACTIVATIONS[i] = 0;
+      app_regs.REG_CHANNEL_ON_TIME[i] = 0;
+   }
+   
+   app_regs.REG_EVT_SUPPRESSED[0] = 0;
+   app_regs.REG_EVT_SUPPRESSED[1] = 0;
+   app_regs.REG_SILENT_SWITCHES = 0;
+   
+   for (uint8_t i = 0; i < 9; i++)
+      app_regs.REG_SNAPSHOT[i] = 0;
+   
+   app_regs.REG_CONFIG_CRC = 0;
+   
+   for (uint8_t i = 0; i < 6; i++)
+      app_regs.REG_DEGLITCH_REJECTS[i] = 0;
+   
+   /* Preset n enables channel n, as the external source does */
+   for (uint8_t i = 0; i < 32; i++)
+      app_regs.REG_PRESETS[i] = (i < 16) ? ((uint16_t)1 << i) : 0;
 }
 
 extern void update_outputs(bool update_DO0, bool from_address_interrupt);
 
 void core_callback_registers_were_reinitialized(void)
 {
+	app_regs.REG_EVT_QUEUE_OVERFLOWS = 0;
+	app_regs.REG_EVT_COALESCED_EDGES[0] = 0;
+	app_regs.REG_EVT_COALESCED_EDGES[1] = 0;
+	app_regs.REG_EVT_COALESCED_EDGES[2] = 0;
+	
+	/* The sequence table is not kept across resets */
+	app_sequence_clear();
+	app_regs.REG_SEQ_CONTROL = GM_SEQ_STOP;
+	
+	/* The armed mask must be written again to arm the trigger */
+	app_regs.REG_ARM_TRIGGER &= ~B_ARM_ARMED;
+	
+	/* A sweep only starts on a write to REG_SWEEP_CONTROL */
+	app_sweep_stop();
+	app_regs.REG_SWEEP_CONTROL = GM_SWEEP_STOP;
+	
+	if (app_regs.REG_SWEEP_DWELL < APP_SWEEP_DWELL_MIN_US)
+		app_regs.REG_SWEEP_DWELL = APP_SWEEP_DWELL_MIN_US;
+	
+	if (app_regs.REG_DO0_PULSE_WIDTH == 0 || app_regs.REG_DO0_PULSE_WIDTH > APP_SYNC_PULSE_WIDTH_MAX_US)
+		app_regs.REG_DO0_PULSE_WIDTH = 100;
+	
+	if (app_regs.REG_DO0_CODE_UNIT < APP_SYNC_CODE_UNIT_MIN_US || app_regs.REG_DO0_CODE_UNIT > APP_SYNC_CODE_UNIT_MAX_US)
+		app_regs.REG_DO0_CODE_UNIT = 50;
+	
+	app_sync_configure();
+	
+	for (uint8_t i = 0; i < 6; i++)
+		app_regs.REG_DEGLITCH_REJECTS[i] = 0;
+	
+	/* The edge history starts empty */
+	app_regs.REG_EDGE_HEAD = 0;
+	app_regs.REG_EDGE_TAIL = 0;
+	
+	for (uint8_t i = 0; i < 16; i++)
+	{
+		app_regs.REG_LATENCY_EXTERNAL[i] = 0;
+		app_regs.REG_LATENCY_USB[i] = 0;
+	}
+	
+	/* The switch statistics count from the last reset */
+	for (uint8_t i = 0; i < 16; i++)
+	{
+		app_regs.REG_CHANNEL_ACTIVATIONS[i] = 0;
+		app_regs.REG_CHANNEL_ON_TIME[i] = 0;
+	}
+	
+	app_regs.REG_EVT_SUPPRESSED[0] = 0;
+	app_regs.REG_EVT_SUPPRESSED[1] = 0;
+	app_regs.REG_SILENT_SWITCHES = 0;
+	
+	if (app_regs.REG_DEGLITCH_TIME > APP_DEGLITCH_TIME_MAX_US)
+		app_regs.REG_DEGLITCH_TIME = 0;
+	
+	if (app_regs.REG_SWITCH_POLICY & ~MSK_SWITCH_POLICY)
+		app_regs.REG_SWITCH_POLICY = GM_SWITCH_SIMULTANEOUS;
+	
+	if (app_regs.REG_SWITCH_DEAD_TIME == 0 || app_regs.REG_SWITCH_DEAD_TIME > APP_DEAD_TIME_MAX_US)
+		app_regs.REG_SWITCH_DEAD_TIME = 100;
+	
+	if (app_regs.REG_INPUTS_PRIORITY > GM_INPUTS_PRIORITY_HIGH)
+		app_regs.REG_INPUTS_PRIORITY = GM_INPUTS_PRIORITY_LOW;
+	
+	app_events_set_window(app_regs.REG_EVT_COALESCE_WINDOW);
+	app_install_handlers();
+	app_deglitch_configure();
+	app_resync_inputs();
+	app_apply_inputs_priority();
+	app_config_changed();
 	update_outputs(false, false);
    
    if (app_regs.REG_DO0_CONF == GM_DO_DIGITAL)
@@ -108,10 +248,27 @@ void core_callback_visualen_to_off(void) {}
 /************************************************************************/
 /* Callbacks: Change on the operation mode                              */
 /************************************************************************/
-void core_callback_device_to_standby(void) {}
-void core_callback_device_to_active(void) {}
+void core_callback_device_to_standby(void)
+{
+	/* Keep the current channel mask, only stop the events */
+	app_set_streaming(false);
+	app_set_standby(true);
+}
+
+void core_callback_device_to_active(void)
+{
+	app_set_streaming(false);
+	app_set_standby(false);
+}
+
 void core_callback_device_to_enchanced_active(void) {}
-void core_callback_device_to_speed(void) {}
+
+void core_callback_device_to_speed(void)
+{
+	/* Stream the IO_STATE record on every change, plus a keep-alive */
+	app_set_standby(false);
+	app_set_streaming(true);
+}
 
 /************************************************************************/
 /* Callbacks: 1 ms timer                                                */
@@ -120,7 +277,17 @@ void core_callback_t_before_exec(void) {}
 void core_callback_t_after_exec(void) {}
 void core_callback_t_new_second(void) {}
 void core_callback_t_500us(void) {}
-void core_callback_t_1ms(void) {}
+void core_callback_t_1ms(void)
+{
+	/* Queue the coalesced events at the end of each window */
+	app_events_tick_1ms();
+	
+	/* Resend the last IO_STATE record while streaming in Speed Mode */
+	app_stream_tick_1ms();
+	
+	/* Accumulate the on-time of the enabled channels */
+	app_stats_tick_1ms();
+}
 
 /************************************************************************/
 /* Callbacks: clock control                                             */
@@ -178,5 +345,13 @@ bool core_write_app_register(uint8_t add, uint8_t type, uint8_t * content, uint1
 		return false;
 
 	/* Process data and return false if write is not allowed or contains errors */
-	return (*app_func_wr_pointer[add-APP_REGS_ADD_MIN])(content);
+	uint8_t nested = app_latency_start(APP_LATENCY_USB);
+	bool written = (*app_func_wr_pointer[add-APP_REGS_ADD_MIN])(content);
+	app_latency_stop(APP_LATENCY_USB, nested);
+	
+	/* Keep REG_CONFIG_CRC up to date with the configuration */
+	if (written)
+		app_config_written(add);
+	
+	return written;
 }
\ No newline at end of file
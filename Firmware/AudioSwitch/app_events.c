@@ -0,0 +1,269 @@
+#include "app_events.h"
+#include "app_ios_and_regs.h"
+#include "hwbp_core_types.h"
+
+/************************************************************************/
+/* Declare application registers                                        */
+/************************************************************************/
+extern AppRegs app_regs;
+extern uint8_t app_regs_type[];
+extern uint16_t app_regs_n_elements[];
+extern uint8_t *app_regs_pointer[];
+
+/************************************************************************/
+/* Ring of pending events                                               */
+/************************************************************************/
+/* Single consumer (main loop). The producers are serialized by a short */
+/* critical section, since a register write can preempt an input ISR.   */
+#define EVENTS_MASK (APP_EVENTS_QUEUE_SIZE - 1)
+
+static app_event_t events[APP_EVENTS_QUEUE_SIZE];
+static volatile uint8_t events_head = 0;
+static volatile uint8_t events_tail = 0;
+
+/* While disabled nothing is queued and pending events are discarded */
+static volatile bool events_enabled = true;
+
+void app_events_read_timestamp(timestamp_t *timestamp)
+{
+	/* Re-read if the second rolled over between the two reads */
+	do
+	{
+		timestamp->second = core_func_read_R_TIMESTAMP_SECOND();
+		timestamp->usecond = core_func_read_R_TIMESTAMP_MICRO();
+	} while (timestamp->second != core_func_read_R_TIMESTAMP_SECOND());
+}
+
+/************************************************************************/
+/* Coalesced events                                                     */
+/************************************************************************/
+/* While a window is set, the events of these registers are kept in one */
+/* slot per register and only the latest one is queued when the window  */
+/* ends. The edges folded into each slot are counted, and sent in the   */
+/* same order in REG_EVT_COALESCED_EDGES when any slot folded edges.    */
+static const uint8_t coalesced_adds[] = {ADD_REG_CHANNEL_SEL, ADD_REG_DI_STATE, ADD_REG_IO_STATE};
+
+#define COALESCED_SLOTS sizeof(coalesced_adds)
+
+static app_event_t coalesced[COALESCED_SLOTS];
+static uint8_t coalesced_pending = 0;
+static uint16_t coalesced_folded[COALESCED_SLOTS];
+
+static uint8_t window_ms = 0;
+static uint8_t window_elapsed = 0;
+
+/* While streaming every event is queued, regardless of the window */
+static bool streaming = false;
+
+/* Must be called with interrupts disabled */
+static bool enqueue(uint8_t add, uint32_t value, const timestamp_t *timestamp)
+{
+	uint8_t head = events_head;
+	uint8_t next = (head + 1) & EVENTS_MASK;
+
+	if (next == events_tail)
+	{
+		if (app_regs.REG_EVT_QUEUE_OVERFLOWS != 0xFFFF)
+			app_regs.REG_EVT_QUEUE_OVERFLOWS++;
+		return false;
+	}
+
+	if (timestamp)
+		events[head].timestamp = *timestamp;
+	else
+		app_events_read_timestamp(&events[head].timestamp);
+	events[head].value = value;
+	events[head].add = add;
+	events_head = next;
+
+	return true;
+}
+
+static void clear_folded(void)
+{
+	for (uint8_t i = 0; i < COALESCED_SLOTS; i++)
+		coalesced_folded[i] = 0;
+}
+
+/* Must be called with interrupts disabled */
+static bool coalesce(uint8_t add, uint32_t value, const timestamp_t *timestamp)
+{
+	for (uint8_t i = 0; i < COALESCED_SLOTS; i++)
+	{
+		if (coalesced_adds[i] != add)
+			continue;
+
+		if (coalesced_pending & (1 << i))
+		{
+			if (coalesced_folded[i] != 0xFFFF)
+				coalesced_folded[i]++;
+		}
+
+		if (timestamp)
+			coalesced[i].timestamp = *timestamp;
+		else
+			app_events_read_timestamp(&coalesced[i].timestamp);
+		coalesced[i].value = value;
+		coalesced[i].add = add;
+		coalesced_pending |= (1 << i);
+
+		return true;
+	}
+
+	return false;
+}
+
+/* Must be called with interrupts disabled */
+static void flush_coalesced(void)
+{
+	bool folded = false;
+
+	for (uint8_t i = 0; i < COALESCED_SLOTS; i++)
+	{
+		if (coalesced_pending & (1 << i))
+			enqueue(coalesced[i].add, coalesced[i].value, &coalesced[i].timestamp);
+
+		if (coalesced_folded[i])
+			folded = true;
+	}
+
+	if (folded)
+	{
+		for (uint8_t i = 0; i < COALESCED_SLOTS; i++)
+			app_regs.REG_EVT_COALESCED_EDGES[i] = coalesced_folded[i];
+
+		if (app_regs.REG_EVNT_ENABLE & B_EVT_COALESCED_EDGES)
+			enqueue(ADD_REG_EVT_COALESCED_EDGES, 0, 0);
+	}
+
+	coalesced_pending = 0;
+	clear_folded();
+}
+
+bool app_events_push(uint8_t add, uint32_t value)
+{
+	return app_events_push_at(add, value, 0);
+}
+
+bool app_events_push_at(uint8_t add, uint32_t value, const timestamp_t *timestamp)
+{
+	if (!events_enabled)
+		return false;
+
+	uint8_t sreg = SREG;
+	cli();
+
+	bool queued;
+
+	if (window_ms && !streaming && coalesce(add, value, timestamp))
+		queued = true;
+	else
+		queued = enqueue(add, value, timestamp);
+
+	SREG = sreg;
+	return queued;
+}
+
+void app_events_set_window(uint8_t ms)
+{
+	uint8_t sreg = SREG;
+	cli();
+	flush_coalesced();
+	window_ms = ms;
+	window_elapsed = 0;
+	SREG = sreg;
+}
+
+void app_events_stream(bool enable)
+{
+	uint8_t sreg = SREG;
+	cli();
+	flush_coalesced();
+	streaming = enable;
+	SREG = sreg;
+}
+
+void app_events_tick_1ms(void)
+{
+	if (!window_ms)
+		return;
+
+	if (++window_elapsed < window_ms)
+		return;
+
+	window_elapsed = 0;
+
+	uint8_t sreg = SREG;
+	cli();
+	flush_coalesced();
+	SREG = sreg;
+}
+
+/* The core builds the event packet from app_regs_pointer[], so each    */
+/* event is sent from its own copy by pointing the register at it. The  */
+/* live register is never written and only the pointer swap runs with   */
+/* interrupts disabled.                                                 */
+static uint8_t event_payload[sizeof(uint32_t)];
+
+void app_events_drain(void)
+{
+	while (events_tail != events_head)
+	{
+		if (!events_enabled)
+		{
+			events_tail = events_head;
+			break;
+		}
+
+		app_event_t *event = &events[events_tail];
+
+		uint8_t index = event->add - APP_REGS_ADD_MIN;
+		uint8_t len = app_regs_type[index] & MSK_TYPE_LEN;
+
+		/* Array registers are sent with the content they already hold */
+		bool staged = (app_regs_n_elements[index] == 1);
+		uint8_t *live = app_regs_pointer[index];
+
+		if (staged)
+		{
+			for (uint8_t i = 0; i < len; i++)
+				event_payload[i] = *(((uint8_t*)(&event->value)) + i);
+
+			uint8_t sreg = SREG;
+			cli();
+			app_regs_pointer[index] = event_payload;
+			SREG = sreg;
+		}
+
+		core_func_update_user_timestamp(event->timestamp.second, event->timestamp.usecond);
+		core_func_send_event(event->add, false);
+
+		if (staged)
+		{
+			uint8_t sreg = SREG;
+			cli();
+			app_regs_pointer[index] = live;
+			SREG = sreg;
+		}
+
+		events_tail = (events_tail + 1) & EVENTS_MASK;
+	}
+}
+
+bool app_events_pending(void)
+{
+	return events_tail != events_head;
+}
+
+void app_events_enable(bool enable)
+{
+	uint8_t sreg = SREG;
+	cli();
+	events_enabled = enable;
+	if (!enable)
+	{
+		coalesced_pending = 0;
+		clear_folded();
+	}
+	SREG = sreg;
+}
\ No newline at end of file
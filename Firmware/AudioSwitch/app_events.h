@@ -0,0 +1,39 @@
+#ifndef _APP_EVENTS_H_
+#define _APP_EVENTS_H_
+#include <avr/io.h>
+#include "hwbp_core.h"
+
+
+/************************************************************************/
+/* Deferred events                                                      */
+/************************************************************************/
+/* Interrupt handlers push the events to a ring and the main loop sends */
+/* them, so the packet framing never runs inside the switching path.    */
+/* Events caused by an input edge carry the time read at the interrupt  */
+/* entry, the others the time they were queued.                         */
+/* Must be a power of 2.                                                */
+#define APP_EVENTS_QUEUE_SIZE 16
+
+typedef struct
+{
+	timestamp_t timestamp;
+	uint32_t value;
+	uint8_t add;
+} app_event_t;
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+bool app_events_push(uint8_t add, uint32_t value);
+bool app_events_push_at(uint8_t add, uint32_t value, const timestamp_t *timestamp);
+void app_events_read_timestamp(timestamp_t *timestamp);
+void app_events_drain(void);
+bool app_events_pending(void);
+void app_events_enable(bool enable);
+void app_events_set_window(uint8_t ms);
+void app_events_stream(bool enable);
+void app_events_tick_1ms(void);
+
+
+#endif /* _APP_EVENTS_H_ */
\ No newline at end of file
@@ -1,9 +1,15 @@
 #include "app_funcs.h"
 #include "app_ios_and_regs.h"
+#include "app_events.h"
+#include "app_sequence.h"
+#include "app_sweep.h"
+#include "app_sync.h"
 #include "hwbp_core.h"
+#include "hwbp_core_types.h"
 
 #define F_CPU 32000000
 #include <util\delay.h>
+#include <util\crc16.h>
 
 /************************************************************************/
 /* Create pointers to functions                                         */
@@ -18,7 +24,48 @@ void (*app_func_rd_pointer[])(void) = {
 	&app_read_REG_RESERVED0,
 	&app_read_REG_DI4_CONF,
 	&app_read_REG_DO0_CONF,
-	&app_read_REG_EVNT_ENABLE
+	&app_read_REG_EVNT_ENABLE,
+	&app_read_REG_SWITCH_POLICY,
+	&app_read_REG_SWITCH_DEAD_TIME,
+	&app_read_REG_INPUTS_PRIORITY,
+	&app_read_REG_EVT_QUEUE_OVERFLOWS,
+	&app_read_REG_EVT_COALESCE_WINDOW,
+	&app_read_REG_EVT_COALESCED_EDGES,
+	&app_read_REG_IO_STATE,
+	&app_read_REG_SEQ_APPEND,
+	&app_read_REG_SEQ_CONTROL,
+	&app_read_REG_SEQ_STATUS,
+	&app_read_REG_SEQ_UNDERRUNS,
+	&app_read_REG_ARMED_MASK,
+	&app_read_REG_ARM_TRIGGER,
+	&app_read_REG_CHANNEL_SET,
+	&app_read_REG_CHANNEL_CLEAR,
+	&app_read_REG_CHANNEL_TOGGLE,
+	&app_read_REG_PRESETS,
+	&app_read_REG_GATE_INPUTS,
+	&app_read_REG_SWEEP_CHANNELS,
+	&app_read_REG_SWEEP_DWELL,
+	&app_read_REG_SWEEP_ORDER,
+	&app_read_REG_SWEEP_SEED,
+	&app_read_REG_SWEEP_REPEATS,
+	&app_read_REG_SWEEP_CONTROL,
+	&app_read_REG_DO0_PULSE_WIDTH,
+	&app_read_REG_DO0_CODE_UNIT,
+	&app_read_REG_DEGLITCH_TIME,
+	&app_read_REG_DEGLITCH_REJECTS,
+	&app_read_REG_STREAM_KEEPALIVE,
+	&app_read_REG_EDGE_HISTORY,
+	&app_read_REG_EDGE_HEAD,
+	&app_read_REG_EDGE_TAIL,
+	&app_read_REG_LATENCY_EXTERNAL,
+	&app_read_REG_LATENCY_USB,
+	&app_read_REG_LATENCY_CLEAR,
+	&app_read_REG_CHANNEL_ACTIVATIONS,
+	&app_read_REG_CHANNEL_ON_TIME,
+	&app_read_REG_EVT_SUPPRESSED,
+	&app_read_REG_SILENT_SWITCHES,
+	&app_read_REG_SNAPSHOT,
+	&app_read_REG_CONFIG_CRC
 };
 
 bool (*app_func_wr_pointer[])(void*) = {
@@ -29,228 +76,1760 @@ bool (*app_func_wr_pointer[])(void*) = {
 	&app_write_REG_RESERVED0,
 	&app_write_REG_DI4_CONF,
 	&app_write_REG_DO0_CONF,
-	&app_write_REG_EVNT_ENABLE
+	&app_write_REG_EVNT_ENABLE,
+	&app_write_REG_SWITCH_POLICY,
+	&app_write_REG_SWITCH_DEAD_TIME,
+	&app_write_REG_INPUTS_PRIORITY,
+	&app_write_REG_EVT_QUEUE_OVERFLOWS,
+	&app_write_REG_EVT_COALESCE_WINDOW,
+	&app_write_REG_EVT_COALESCED_EDGES,
+	&app_write_REG_IO_STATE,
+	&app_write_REG_SEQ_APPEND,
+	&app_write_REG_SEQ_CONTROL,
+	&app_write_REG_SEQ_STATUS,
+	&app_write_REG_SEQ_UNDERRUNS,
+	&app_write_REG_ARMED_MASK,
+	&app_write_REG_ARM_TRIGGER,
+	&app_write_REG_CHANNEL_SET,
+	&app_write_REG_CHANNEL_CLEAR,
+	&app_write_REG_CHANNEL_TOGGLE,
+	&app_write_REG_PRESETS,
+	&app_write_REG_GATE_INPUTS,
+	&app_write_REG_SWEEP_CHANNELS,
+	&app_write_REG_SWEEP_DWELL,
+	&app_write_REG_SWEEP_ORDER,
+	&app_write_REG_SWEEP_SEED,
+	&app_write_REG_SWEEP_REPEATS,
+	&app_write_REG_SWEEP_CONTROL,
+	&app_write_REG_DO0_PULSE_WIDTH,
+	&app_write_REG_DO0_CODE_UNIT,
+	&app_write_REG_DEGLITCH_TIME,
+	&app_write_REG_DEGLITCH_REJECTS,
+	&app_write_REG_STREAM_KEEPALIVE,
+	&app_write_REG_EDGE_HISTORY,
+	&app_write_REG_EDGE_HEAD,
+	&app_write_REG_EDGE_TAIL,
+	&app_write_REG_LATENCY_EXTERNAL,
+	&app_write_REG_LATENCY_USB,
+	&app_write_REG_LATENCY_CLEAR,
+	&app_write_REG_CHANNEL_ACTIVATIONS,
+	&app_write_REG_CHANNEL_ON_TIME,
+	&app_write_REG_EVT_SUPPRESSED,
+	&app_write_REG_SILENT_SWITCHES,
+	&app_write_REG_SNAPSHOT,
+	&app_write_REG_CONFIG_CRC
 };
 
 
+/************************************************************************/
+/* Input sample                                                         */
+/************************************************************************/
+/* IN0-IN4 are sampled to bits 0-4 (same as REG_DI_STATE) and ADD to    */
+/* bit 5, with a single read of PORTB and PORTC.                        */
+#define B_IN_ADD                 (1<<5)
+#define MSK_IN_DI                (B_DI0 | B_DI1 | B_DI2 | B_DI3 | B_DI4)
+#define MSK_IN_CODE              (B_DI0 | B_DI1 | B_DI2 | B_DI3)
+#define MSK_IN_ADDRESS           (B_DI4 | B_IN_ADD)
+
+static uint8_t sample_inputs(void)
+{
+   uint8_t portc = PORTC_IN;
+   
+   return (PORTB_IN & 0x0F) | ((portc & (1<<0)) << 4) | ((portc & (1<<4)) << 1);
+}
+
+/************************************************************************/
+/* External address decode table                                        */
+/************************************************************************/
+/* Index bits 0-3 are IN0-IN3 and bit 4 is set when the board is not    */
+/* addressed (DI4 used as address and ADD different from IN4).          */
+/* Entries 16 to 31 are left at zero, disabling all the channels.       */
+#define EXT_ONE_HOT(ch)    ((uint16_t)1 << (ch))
+#define EXT_ONE_HOT_x4(ch) EXT_ONE_HOT(ch), EXT_ONE_HOT(ch+1), EXT_ONE_HOT(ch+2), EXT_ONE_HOT(ch+3)
+
+#define EXT_LUT_NOT_ADDRESSED (1<<4)
+
+static const uint16_t ext_decode_lut[32] = {
+   EXT_ONE_HOT_x4(0), EXT_ONE_HOT_x4(4), EXT_ONE_HOT_x4(8), EXT_ONE_HOT_x4(12)
+};
+
+/************************************************************************/
+/* Decoders of the channels to enable                                   */
+/************************************************************************/
+/* Bit 4 of the result is set when ADD and IN4 are different */
+#define not_addressed(inputs) ((((inputs) >> 1) ^ (inputs)) & EXT_LUT_NOT_ADDRESSED)
+
+static uint16_t decode_usb(uint8_t inputs)
+{
+   return app_regs.REG_CHANNEL_SEL;
+}
+
+static uint16_t decode_usb_addressed(uint8_t inputs)
+{
+   return not_addressed(inputs) ? 0 : app_regs.REG_CHANNEL_SEL;
+}
+
+/* The host mask is blanked while any of REG_GATE_INPUTS is low */
+#define gate_is_closed(inputs) (((inputs) & app_regs.REG_GATE_INPUTS) != app_regs.REG_GATE_INPUTS)
+
+static uint16_t decode_usb_gated(uint8_t inputs)
+{
+   return gate_is_closed(inputs) ? 0 : app_regs.REG_CHANNEL_SEL;
+}
+
+static uint16_t decode_usb_gated_addressed(uint8_t inputs)
+{
+   return (not_addressed(inputs) || gate_is_closed(inputs)) ? 0 : app_regs.REG_CHANNEL_SEL;
+}
+
+static uint16_t decode_external(uint8_t inputs)
+{
+   return ext_decode_lut[inputs & MSK_IN_CODE];
+}
+
+static uint16_t decode_external_addressed(uint8_t inputs)
+{
+   return ext_decode_lut[(inputs & MSK_IN_CODE) | not_addressed(inputs)];
+}
+
+/* IN0-IN4 select one of the 32 presets */
+static uint16_t decode_presets(uint8_t inputs)
+{
+   return app_regs.REG_PRESETS[inputs & MSK_IN_DI];
+}
+
+/* IN0-IN3 select one of the first 16 presets */
+static uint16_t decode_presets_addressed(uint8_t inputs)
+{
+   return not_addressed(inputs) ? 0 : app_regs.REG_PRESETS[inputs & MSK_IN_CODE];
+}
+
+/************************************************************************/
+/* Switch latency                                                       */
+/************************************************************************/
+/* TCE0 runs free at 4 MHz. The count read when an input edge or a host */
+/* write is dispatched is compared with the count read when the ports   */
+/* are written. Bin n of the histograms counts latencies of n bits,     */
+/* from 2^(n-1) to 2^n - 1 counts of 0.25 us, and the last bin also the */
+/* longer ones.                                                         */
+#define LATENCY_BINS 16
+
+/* The host writes and the input interrupts can nest, so each path has  */
+/* its own start and end. latency_path is the innermost dispatch still  */
+/* waiting for the ports, and each dispatch restores the one it nested. */
+static volatile uint8_t latency_path = 0;
+static uint16_t latency_start[2];
+static uint16_t latency_end[2];
+static volatile uint8_t latency_ended = 0;
+
+#define latency_bit(path) (1 << ((path) - 1))
+
+static uint16_t read_tce0_count(void)
+{
+   uint8_t sreg = SREG;
+   cli();
+   uint16_t count = TCE0.CNT;
+   SREG = sreg;
+   
+   return count;
+}
+
+uint8_t app_latency_start(uint8_t path)
+{
+   return app_latency_start_at(path, read_tce0_count());
+}
+
+/* Returns the path to give back to app_latency_stop() */
+uint8_t app_latency_start_at(uint8_t path, uint16_t count)
+{
+   uint8_t sreg = SREG;
+   cli();
+   uint8_t nested = latency_path;
+   latency_start[path - 1] = count;
+   latency_ended &= ~latency_bit(path);
+   latency_path = path;
+   SREG = sreg;
+   
+   return nested;
+}
+
+/* Called once the dispatch returns, so the binning runs after the DO0  */
+/* mark. Discards the start if the dispatch didn't write the ports.     */
+void app_latency_stop(uint8_t path, uint8_t nested)
+{
+   uint8_t sreg = SREG;
+   cli();
+   bool ended = latency_ended & latency_bit(path);
+   latency_ended &= ~latency_bit(path);
+   latency_path = nested;
+   SREG = sreg;
+   
+   if (!ended)
+      return;
+   
+   uint16_t latency = latency_end[path - 1] - latency_start[path - 1];
+   uint16_t *histogram = (path == APP_LATENCY_EXTERNAL) ? app_regs.REG_LATENCY_EXTERNAL : app_regs.REG_LATENCY_USB;
+   uint8_t bin = 0;
+   
+   while (latency && bin < LATENCY_BINS - 1)
+   {
+      latency >>= 1;
+      bin++;
+   }
+   
+   if (histogram[bin] != 0xFFFF)
+      histogram[bin]++;
+}
+
+/************************************************************************/
+/* Output commit stage                                                  */
+/************************************************************************/
+/* TCD0 times the dead time of the break-before-make policy.            */
+/* Counts at 4 MHz, so the dead time is limited to 16 ms.               */
+/* It runs at the level of the inputs, like every timer that switches   */
+/* the outputs, and the commit is a critical section, so the dead time  */
+/* can't expire between a new target and the restart of the timer.      */
+static uint16_t outputs_target;
+static volatile bool dead_time_running = false;
+
+/* Coherent snapshot of EN0-EN15 */
+uint16_t app_read_outputs(void)
+{
+   uint16_t outputs;
+   uint8_t sreg = SREG;
+   cli();
+   *(((uint8_t*)(&outputs)) + 0) = PORTA_IN;
+   *(((uint8_t*)(&outputs)) + 1) = PORTD_IN;
+   SREG = sreg;
+   
+   return outputs;
+}
+
+/* Both ports are written back-to-back with interrupts disabled,        */
+/* so the skew between EN0-EN7 and EN8-EN15 is a single store           */
+static void write_outputs(uint16_t outputs)
+{
+   uint8_t port_a = *(((uint8_t*)(&outputs)) + 0);
+   uint8_t port_d = *(((uint8_t*)(&outputs)) + 1);
+   
+   uint8_t sreg = SREG;
+   cli();
+   PORTA_OUT = port_a;
+   PORTD_OUT = port_d;
+   if (latency_path)
+   {
+      latency_end[latency_path - 1] = TCE0.CNT;
+      latency_ended |= latency_bit(latency_path);
+      latency_path = 0;
+   }
+   SREG = sreg;
+}
+
+void app_commit_outputs(uint16_t enable)
+{
+   uint8_t sreg = SREG;
+   cli();
+   
+   outputs_target = enable;
+   
+   if (app_regs.REG_SWITCH_POLICY == GM_SWITCH_BREAK_BEFORE_MAKE)
+   {
+      uint16_t outputs = app_read_outputs();
+      
+      /* Disable the channels that are not in the new mask and (re)start the dead time */
+      if ((outputs & enable) != outputs)
+      {
+         write_outputs(outputs & enable);
+         
+         dead_time_running = true;
+         timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV8, app_regs.REG_SWITCH_DEAD_TIME * 4, app_inputs_int_level());
+         TCD0.INTFLAGS = TC0_OVFIF_bm;
+         
+         SREG = sreg;
+         return;
+      }
+      
+      /* The new mask will be applied when the dead time expires */
+      if (dead_time_running)
+      {
+         SREG = sreg;
+         return;
+      }
+   }
+   
+   write_outputs(enable);
+   SREG = sreg;
+}
+
+void app_complete_break_before_make(void)
+{
+   uint8_t sreg = SREG;
+   cli();
+   
+   timer_type0_stop(&TCD0);
+   dead_time_running = false;
+   
+   write_outputs(outputs_target);
+   SREG = sreg;
+}
+
+/************************************************************************/
+/* Actions taken after a channel switch                                 */
+/************************************************************************/
+#define SW_ACT_MARK_DO0          (1<<0)      // Mark the switch on DO0
+#define SW_ACT_EVT_EXTERNAL      (1<<1)      // Send CHANNEL_SEL with the new outputs
+#define SW_ACT_EVT_ADDRESS       (1<<2)      // Send CHANNEL_SEL when ADD/IN4 gate the host mask
+#define SW_ACT_EVT_IO_STATE      (1<<3)      // Send IO_STATE instead of CHANNEL_SEL and DI_STATE
+
+static uint16_t (*decode_enable)(uint8_t inputs) = &decode_usb;
+static uint8_t switch_actions;
+
+static uint32_t io_state(uint8_t inputs)
+{
+   return outputs_target | ((uint32_t)(inputs & MSK_IN_DI) << 16) | (read_DO0 ? B_IO_STATE_DO0 : 0);
+}
+
+/* In Speed Mode every change is streamed as an IO_STATE event and the  */
+/* last state is sent again after REG_STREAM_KEEPALIVE ms without one.  */
+static bool streaming = false;
+static uint16_t stream_idle_ms;
+
+static bool push_io_state(uint8_t inputs, const timestamp_t *when)
+{
+   stream_idle_ms = 0;
+   return app_events_push_at(ADD_REG_IO_STATE, io_state(inputs), when);
+}
+
+/* In standby the outputs keep switching but no events are generated */
+static bool standby = false;
+
+/************************************************************************/
+/* Switch statistics                                                    */
+/************************************************************************/
+/* A switch is silent when it is not reported by any event, either      */
+/* because of REG_EVNT_ENABLE, Standby Mode or a full event queue.      */
+/* Host writes that switch a host source are answered by the write      */
+/* reply and are never counted.                                         */
+static void count_silent_switch(void)
+{
+   if (app_regs.REG_SILENT_SWITCHES != 0xFFFF)
+      app_regs.REG_SILENT_SWITCHES++;
+}
+
+static void count_suppressed(uint8_t index)
+{
+   if (!standby && app_regs.REG_EVT_SUPPRESSED[index] != 0xFFFF)
+      app_regs.REG_EVT_SUPPRESSED[index]++;
+}
+
+static void count_activations(uint16_t enabled)
+{
+   for (uint8_t i = 0; enabled; i++, enabled >>= 1)
+      if (enabled & 1)
+         app_regs.REG_CHANNEL_ACTIVATIONS[i]++;
+}
+
+void app_stats_tick_1ms(void)
+{
+   uint16_t outputs = app_read_outputs();
+   
+   for (uint8_t i = 0; outputs; i++, outputs >>= 1)
+      if (outputs & 1)
+         app_regs.REG_CHANNEL_ON_TIME[i]++;
+}
+
+/* New host mask, ((REG_CHANNEL_SEL | set) & ~clear) ^ toggle */
+typedef struct
+{
+   uint16_t set;
+   uint16_t clear;
+   uint16_t toggle;
+} channel_sel_op_t;
+
+/* Returns true if the switch must be reported. The CHANNEL_SEL event   */
+/* is sent here, the IO_STATE event is left to the caller.              */
+/* The host mask is updated, decoded and committed in one critical      */
+/* section, so a switch decoded from a stale REG_CHANNEL_SEL is never   */
+/* committed over a newer one, whatever the priority of the writer.     */
+static bool switch_outputs(uint8_t inputs, const channel_sel_op_t *op, bool update_DO0, bool from_address_interrupt, const timestamp_t *edge)
+{
+   uint16_t current_state;
+   uint16_t new_state;
+   bool report = false;
+   
+   uint8_t sreg = SREG;
+   cli();
+   if (op)
+   {
+      app_regs.REG_CHANNEL_SEL = ((app_regs.REG_CHANNEL_SEL | op->set) & ~op->clear) ^ op->toggle;
+   }
+   current_state = outputs_target;
+   new_state = (*decode_enable)(inputs);
+   app_commit_outputs(new_state);
+   SREG = sreg;
+   
+   if (current_state != new_state)
+   {
+      if (update_DO0 && (switch_actions & SW_ACT_MARK_DO0))
+      {
+         app_sync_mark(new_state);
+      }
+      
+      /* After the mark, so DO0 keeps a fixed offset to the port write */
+      count_activations(new_state & ~current_state);
+                     
+      if (switch_actions & SW_ACT_EVT_EXTERNAL)
+      {
+         app_regs.REG_CHANNEL_SEL = new_state;
+         report = true;
+      }
+      
+      /* REG_CHANNEL_SEL keeps the host mask, the event carries the outputs */
+      if (from_address_interrupt && (switch_actions & SW_ACT_EVT_ADDRESS))
+      {
+         report = true;
+      }
+      
+      if (report && !(switch_actions & SW_ACT_EVT_IO_STATE))
+      {
+         if (!app_events_push_at(ADD_REG_CHANNEL_SEL, new_state, edge))
+            count_silent_switch();
+      }
+      
+      if (!report && (from_address_interrupt || !app_source_is_host(app_regs.REG_SOURCE)))
+      {
+         count_silent_switch();
+         count_suppressed(0);
+      }
+   }
+   
+   return report;
+}
+
+static uint8_t current_inputs(void);
+
 void update_outputs(bool update_DO0, bool from_address_interrupt)
 {
-   uint16_t current_state, new_state;
+   uint8_t inputs = current_inputs();
+   
+   if (switch_outputs(inputs, 0, update_DO0, from_address_interrupt, 0) && (switch_actions & SW_ACT_EVT_IO_STATE))
+   {
+      if (!push_io_state(inputs, 0))
+         count_silent_switch();
+   }
+}
+
+static void modify_outputs(const channel_sel_op_t *op, bool from_address_interrupt, const timestamp_t *when)
+{
+   uint8_t inputs = current_inputs();
+   
+   if (switch_outputs(inputs, op, true, from_address_interrupt, when) && (switch_actions & SW_ACT_EVT_IO_STATE))
+   {
+      if (!push_io_state(inputs, when))
+         count_silent_switch();
+   }
+}
+
+/* Sets a new host mask without a host write (host sources only).       */
+/* The switch is reported like the ones gated by the address inputs.    */
+void app_set_channel_sel(uint16_t mask, const timestamp_t *when)
+{
+   channel_sel_op_t op = {mask, ~mask, 0};
+   
+   modify_outputs(&op, true, when);
+}
+
+/************************************************************************/
+/* Input sampler                                                        */
+/************************************************************************/
+/* Input changes that switch the outputs and that generate DI_STATE     */
+/* events, resolved when the configuration changes                      */
+static uint8_t switch_inputs;
+static uint8_t di_inputs;
+static uint8_t di_event_inputs;
+static uint8_t inputs_last;
+
+/* Input edges that apply REG_ARMED_MASK, cleared once it is applied */
+static uint8_t arm_rising;
+static uint8_t arm_falling;
+
+/* Every edge is logged to REG_EDGE_HISTORY as two words, the second    */
+/* and then R_TIMESTAMP_MICRO with the inputs. The host reads           */
+/* REG_EDGE_HEAD, then the ring, and writes that head to REG_EDGE_TAIL. */
+/* Edges on a full ring are dropped.                                    */
+static void log_edge(uint8_t inputs, const timestamp_t *edge)
+{
+   uint8_t head = app_regs.REG_EDGE_HEAD & MSK_EDGE_INDEX;
+   uint8_t next = (head + 1) & MSK_EDGE_INDEX;
+   
+   if (next == app_regs.REG_EDGE_TAIL)
+   {
+      app_regs.REG_EDGE_HEAD |= B_EDGE_OVERFLOW;
+      return;
+   }
+   
+   app_regs.REG_EDGE_HISTORY[head * 2] = edge->second;
+   app_regs.REG_EDGE_HISTORY[head * 2 + 1] = edge->usecond | ((uint32_t)inputs << 16);
+   app_regs.REG_EDGE_HEAD = next | (app_regs.REG_EDGE_HEAD & B_EDGE_OVERFLOW);
+}
+
+/* Switches and reports a new state of the inputs */
+static void process_inputs(uint8_t inputs, const timestamp_t *edge)
+{
+   uint8_t changed = inputs ^ inputs_last;
+   inputs_last = inputs;
+   
+   bool report = false;
+   
+   /* The armed mask replaces the host mask in the same switch */
+   if (changed & ((inputs & arm_rising) | (~inputs & arm_falling)))
+   {
+      channel_sel_op_t op = {app_regs.REG_ARMED_MASK, ~app_regs.REG_ARMED_MASK, 0};
+      
+      arm_rising = 0;
+      arm_falling = 0;
+      report = switch_outputs(inputs, &op, true, true, edge);
+   }
+   else if (changed & switch_inputs)
+   {
+      report = switch_outputs(inputs, 0, true, true, edge);
+   }
+   
+   /* Logged after the switch, so it doesn't add to the latency */
+   if (changed)
+      log_edge(inputs, edge);
+   
+   app_regs.REG_DI_STATE = inputs & MSK_IN_DI;
+   
+   /* A single IO_STATE event reports both the switch and the inputs */
+   if (switch_actions & SW_ACT_EVT_IO_STATE)
+   {
+      if (report || (changed & di_event_inputs))
+      {
+         if (!push_io_state(inputs, edge) && report)
+            count_silent_switch();
+      }
+   }
+   else if (changed & di_event_inputs)
+   {
+      app_events_push_at(ADD_REG_DI_STATE, inputs & MSK_IN_DI, edge);
+   }
+   
+   if ((changed & di_inputs) && !di_event_inputs)
+      count_suppressed(1);
+}
+
+/************************************************************************/
+/* Input deglitch                                                       */
+/************************************************************************/
+/* TCE0 runs free at 4 MHz. Each input has its own settle time, started */
+/* by its last edge, and is only used once it was stable for            */
+/* REG_DEGLITCH_TIME, so a chattering input never holds the others.     */
+/* CCA is set to the nearest settle time. Inputs that settle within     */
+/* DEGLITCH_GROUP_COUNTS of each other are used together, so the bits   */
+/* of a code that change at the same time are never applied apart.      */
+/* Inputs that toggled and came back meanwhile count as glitches.       */
+#define DEGLITCH_COUNTS_PER_US 4
+#define DEGLITCH_GROUP_COUNTS  (10 * DEGLITCH_COUNTS_PER_US)
+
+static uint16_t deglitch_counts = 0;
+static uint8_t raw_last;
+static uint8_t raw_pending;
+static uint8_t raw_toggled;
+static uint16_t raw_start[6];
+static timestamp_t raw_edge[6];
+
+/* Sets CCA to the nearest settle time of the pending inputs */
+static void deglitch_schedule(void)
+{
+   if (!raw_pending)
+   {
+      TCE0.INTCTRLB = 0;
+      return;
+   }
+   
+   /* The 16-bit accesses share the TEMP register with the host writes */
+   uint8_t sreg = SREG;
+   cli();
+   uint16_t now = TCE0.CNT;
+   uint16_t wait = deglitch_counts;
+   
+   for (uint8_t i = 0; i < 6; i++)
+   {
+      if (!(raw_pending & (1 << i)))
+         continue;
+      
+      uint16_t elapsed = now - raw_start[i];
+      uint16_t remaining = (elapsed >= deglitch_counts) ? 0 : deglitch_counts - elapsed;
+      
+      if (remaining < wait)
+         wait = remaining;
+   }
+   
+   /* Far enough ahead that the compare can't be missed */
+   if (wait < DEGLITCH_GROUP_COUNTS)
+      wait = DEGLITCH_GROUP_COUNTS;
+   
+   TCE0.CCA = now + wait;
+   SREG = sreg;
+   
+   TCE0.INTFLAGS = TC0_CCAIF_bm;
+   TCE0.INTCTRLB = app_inputs_int_level();
+}
+
+static void deglitch_edge(uint8_t inputs, const timestamp_t *edge, uint16_t edge_count)
+{
+   uint8_t changed = inputs ^ raw_last;
+   raw_last = inputs;
+   
+   for (uint8_t i = 0; i < 6; i++)
+   {
+      if (changed & (1 << i))
+      {
+         raw_start[i] = edge_count;
+         raw_edge[i] = *edge;
+      }
+   }
+   
+   raw_pending |= changed;
+   raw_toggled |= changed;
+   
+   deglitch_schedule();
+}
+
+/* Called by the TCE0 CCA interrupt at the nearest settle time */
+void app_deglitch_service(void)
+{
+   TCE0.INTCTRLB = 0;
+   
+   uint8_t inputs = sample_inputs();
+   uint16_t now = read_tce0_count();
+   
+   /* An edge after the last one is still to be handled and restarts its time */
+   uint8_t unstable = inputs ^ raw_last;
+   uint8_t due = 0;
+   uint8_t latest = 0;
+   uint16_t latest_elapsed = 0xFFFF;
+   
+   for (uint8_t i = 0; i < 6; i++)
+   {
+      uint8_t bit = (1 << i);
+      
+      if (!(raw_pending & bit) || (unstable & bit))
+         continue;
+      
+      uint16_t elapsed = now - raw_start[i];
+      
+      if (elapsed >= deglitch_counts || deglitch_counts - elapsed <= DEGLITCH_GROUP_COUNTS)
+      {
+         due |= bit;
+         
+         if (elapsed < latest_elapsed)
+         {
+            latest_elapsed = elapsed;
+            latest = i;
+         }
+      }
+   }
+   
+   raw_pending &= ~due;
+   
+   uint8_t settled = (inputs_last & ~due) | (raw_last & due);
+   uint8_t rejected = raw_toggled & due & ~(settled ^ inputs_last);
+   raw_toggled &= ~due;
+   
+   for (uint8_t i = 0; i < 6; i++)
+      if ((rejected & (1 << i)) && app_regs.REG_DEGLITCH_REJECTS[i] != 0xFFFF)
+         app_regs.REG_DEGLITCH_REJECTS[i]++;
+   
+   deglitch_schedule();
+   
+   if (settled == inputs_last)
+      return;
+   
+   /* The latency includes the deglitch time */
+   uint8_t nested = app_latency_start_at(APP_LATENCY_EXTERNAL, raw_start[latest]);
+   process_inputs(settled, &raw_edge[latest]);
+   app_latency_stop(APP_LATENCY_EXTERNAL, nested);
+}
+
+/* Must be called every time REG_DEGLITCH_TIME changes */
+void app_deglitch_configure(void)
+{
+   uint8_t sreg = SREG;
+   cli();
    
-   *(((uint8_t*)(&current_state)) + 0) = PORTA_IN;
-   *(((uint8_t*)(&current_state)) + 1) = PORTD_IN;
+   if ((TCE0.CTRLA & TC_CLKSEL_gm) == TC_CLKSEL_OFF_gc)
+   {
+      TCE0.PER = 0xFFFF;
+      TCE0.CTRLA = TC_CLKSEL_DIV8_gc;
+   }
+   
+   TCE0.INTCTRLB = 0;
+   deglitch_counts = app_regs.REG_DEGLITCH_TIME * DEGLITCH_COUNTS_PER_US;
+   raw_last = inputs_last;
+   raw_pending = 0;
+   raw_toggled = 0;
+   
+   SREG = sreg;
+}
+
+/* The inputs used by the decoders, which lag the pins while filtered */
+static uint8_t current_inputs(void)
+{
+   return deglitch_counts ? inputs_last : sample_inputs();
+}
+
+/* Called by every input interrupt. The input interrupt flags are       */
+/* cleared before the sample, so edges up to the sample are handled     */
+/* here once and later edges raise a new interrupt.                     */
+/* The edge time is read first, so the events it causes carry the time  */
+/* of the interrupt instead of the time their packets are built.        */
+/* TCE0 is read before it, as the start of the switch latency.          */
+void app_sample_inputs(void)
+{
+   uint16_t edge_count = read_tce0_count();
+   timestamp_t edge;
+   app_events_read_timestamp(&edge);
+   
+   PORTB.INTFLAGS = PORT_INT0IF_bm;
+   PORTC.INTFLAGS = PORT_INT0IF_bm | PORT_INT1IF_bm;
+   
+   uint8_t inputs = sample_inputs();
+   
+   if (deglitch_counts)
+   {
+      deglitch_edge(inputs, &edge, edge_count);
+   }
+   else
+   {
+      uint8_t nested = app_latency_start_at(APP_LATENCY_EXTERNAL, edge_count);
+      process_inputs(inputs, &edge);
+      app_latency_stop(APP_LATENCY_EXTERNAL, nested);
+   }
+}
+
+void app_set_standby(bool enable)
+{
+   standby = enable;
+   app_events_enable(!enable);
+   app_install_handlers();
+}
+
+/* Speed Mode enables every input and switch report as IO_STATE events  */
+/* and sends them without the coalescing window                         */
+void app_set_streaming(bool enable)
+{
+   streaming = enable;
+   stream_idle_ms = 0;
+   app_events_stream(enable);
+   app_install_handlers();
+}
+
+void app_stream_tick_1ms(void)
+{
+   if (!streaming || !app_regs.REG_STREAM_KEEPALIVE)
+      return;
+   
+   if (++stream_idle_ms < app_regs.REG_STREAM_KEEPALIVE)
+      return;
+   
+   push_io_state(current_inputs(), 0);
+}
+
+/* Resolve the decoder and actions for the current configuration.       */
+/* Must be called every time REG_SOURCE, REG_DI4_CONF, REG_DO0_CONF or  */
+/* REG_EVNT_ENABLE changes.                                             */
+void app_install_handlers(void)
+{
+   bool external = !app_source_is_host(app_regs.REG_SOURCE);
+   bool addressed = (app_regs.REG_DI4_CONF == GM_DI4_ADDRESS);
+   uint8_t events = standby ? 0 : app_regs.REG_EVNT_ENABLE;
+   
+   if (streaming)
+      events = B_EVT_OUTPUT_CHANNEL | B_EVT_DI_STATE | B_EVT_IO_STATE;
+   
+   uint16_t (*decoder)(uint8_t inputs);
+   uint8_t actions = 0;
+   uint8_t switching = addressed ? MSK_IN_ADDRESS : 0;
+   uint8_t digital = addressed ? 0 : B_DI4;
+   
+   if (app_regs.REG_SOURCE == GM_EXTERNAL_PRESETS)
+   {
+      decoder = addressed ? &decode_presets_addressed : &decode_presets;
+      switching |= addressed ? MSK_IN_CODE : MSK_IN_DI;
+   }
+   else if (external)
+   {
+      decoder = addressed ? &decode_external_addressed : &decode_external;
+      switching |= MSK_IN_CODE;
+   }
+   else if (app_regs.REG_SOURCE == GM_USB_GATED)
+   {
+      decoder = addressed ? &decode_usb_gated_addressed : &decode_usb_gated;
+      switching |= app_regs.REG_GATE_INPUTS;
+      digital |= MSK_IN_CODE;
+   }
+   else
+   {
+      decoder = addressed ? &decode_usb_addressed : &decode_usb;
+      digital |= MSK_IN_CODE;
+   }
+   
+   if (app_regs.REG_DO0_CONF != GM_DO_DIGITAL)
+      actions |= SW_ACT_MARK_DO0;
+   
+   if (events & B_EVT_OUTPUT_CHANNEL)
+      actions |= external ? SW_ACT_EVT_EXTERNAL : SW_ACT_EVT_ADDRESS;
+   
+   if (events & B_EVT_IO_STATE)
+      actions |= SW_ACT_EVT_IO_STATE;
+   
+   /* The input interrupts must not see a half-written configuration */
+   uint8_t sreg = SREG;
+   cli();
+   decode_enable = decoder;
+   switch_actions = actions;
+   switch_inputs = switching;
+   di_inputs = digital;
+   di_event_inputs = (events & B_EVT_DI_STATE) ? (streaming ? MSK_IN_DI : digital) : 0;
+   SREG = sreg;
+}
+
+/* Handles the current inputs as an input interrupt would, so a pending */
+/* edge is neither lost nor handled twice. Used after a reset.          */
+void app_resync_inputs(void)
+{
+   uint8_t sreg = SREG;
+   cli();
+   app_sample_inputs();
+   SREG = sreg;
+}
+
+/* Arms or disarms the trigger of REG_ARMED_MASK (host sources only) */
+static void arm_trigger(bool arm)
+{
+   uint8_t input = (1 << (app_regs.REG_ARM_TRIGGER & MSK_ARM_INPUT));
+   uint8_t edge = app_regs.REG_ARM_TRIGGER & MSK_ARM_EDGE;
+   
+   if (!app_source_is_host(app_regs.REG_SOURCE))
+      arm = false;
+   
+   uint8_t sreg = SREG;
+   cli();
+   arm_rising = (arm && (edge & GM_ARM_EDGE_RISING)) ? input : 0;
+   arm_falling = (arm && (edge & GM_ARM_EDGE_FALLING)) ? input : 0;
+   SREG = sreg;
+}
+
+static bool trigger_is_armed(void)
+{
+   return (arm_rising | arm_falling) ? true : false;
+}
+
+/* Level of the input interrupts. The timers that switch the outputs    */
+/* (sequence, sweep, deglitch) use it too, so the switches never nest.  */
+uint8_t app_inputs_int_level(void)
+{
+   return app_regs.REG_INPUTS_PRIORITY + INT_LEVEL_LOW;
+}
+
+/* Set the interrupt level of IN0-IN4 and ADD from REG_INPUTS_PRIORITY */
+void app_apply_inputs_priority(void)
+{
+   uint8_t int_level = app_inputs_int_level();
+   
+   io_set_int(&PORTB, int_level, 0, (1<<0) | (1<<1) | (1<<2) | (1<<3), false);   // IN0-3
+   io_set_int(&PORTC, int_level, 0, (1<<0), false);                              // IN4
+   io_set_int(&PORTC, int_level, 1, (1<<4), false);                              // ADD
+}
+
+/************************************************************************/
+/* Configuration fingerprint                                            */
+/************************************************************************/
+/* REG_CONFIG_CRC is the CRC-16 (CCITT) of these registers, in this     */
+/* order. Commands, counters and the live state are left out.           */
+/* A write only marks it stale, it is recomputed by the main loop so    */
+/* the host writes never run the CRC in interrupt context.              */
+extern uint8_t app_regs_type[];
+extern uint16_t app_regs_n_elements[];
+extern uint8_t *app_regs_pointer[];
+
+static const uint8_t config_adds[] = {
+   ADD_REG_SOURCE, ADD_REG_DI4_CONF, ADD_REG_DO0_CONF, ADD_REG_EVNT_ENABLE,
+   ADD_REG_SWITCH_POLICY, ADD_REG_SWITCH_DEAD_TIME, ADD_REG_INPUTS_PRIORITY, ADD_REG_EVT_COALESCE_WINDOW,
+   ADD_REG_PRESETS, ADD_REG_GATE_INPUTS,
+   ADD_REG_SWEEP_CHANNELS, ADD_REG_SWEEP_DWELL, ADD_REG_SWEEP_ORDER, ADD_REG_SWEEP_SEED, ADD_REG_SWEEP_REPEATS,
+   ADD_REG_DO0_PULSE_WIDTH, ADD_REG_DO0_CODE_UNIT, ADD_REG_DEGLITCH_TIME, ADD_REG_STREAM_KEEPALIVE
+};
+
+static volatile bool config_stale = true;
+
+/* Must be called from the main loop */
+void app_update_config_crc(void)
+{
+   if (!config_stale)
+      return;
+   
+   config_stale = false;
+   
+   uint16_t crc = 0xFFFF;
+   
+   for (uint8_t i = 0; i < sizeof(config_adds); i++)
+   {
+      uint8_t index = config_adds[i] - APP_REGS_ADD_MIN;
+      uint8_t *reg = app_regs_pointer[index];
+      uint16_t len = (app_regs_type[index] & MSK_TYPE_LEN) * app_regs_n_elements[index];
+      
+      for (uint16_t j = 0; j < len; j++)
+         crc = _crc_ccitt_update(crc, reg[j]);
+   }
+   
+   /* Dropped if a write came meanwhile, the next pass includes it */
+   uint8_t sreg = SREG;
+   cli();
+   if (!config_stale)
+      app_regs.REG_CONFIG_CRC = crc;
+   SREG = sreg;
+}
+
+bool app_config_crc_stale(void)
+{
+   return config_stale;
+}
+
+void app_config_changed(void)
+{
+   config_stale = true;
+}
+
+/* Must be called after every successful write of a register */
+void app_config_written(uint8_t add)
+{
+   for (uint8_t i = 0; i < sizeof(config_adds); i++)
+   {
+      if (config_adds[i] == add)
+      {
+         app_config_changed();
+         return;
+      }
+   }
+}
+
+/************************************************************************/
+/* REG_SOURCE                                                           */
+/************************************************************************/
+void app_read_REG_SOURCE(void) {}
+bool app_write_REG_SOURCE(void *a)
+{
+   uint16_t reg = *((uint8_t*)a);
+   
+   if (reg > GM_USB_GATED)
+      return false;
+
+   if (reg != app_regs.REG_SOURCE)
+   {
+      if (!app_source_is_host(reg))
+      {
+         app_sequence_stop();
+         app_sweep_stop();
+         arm_trigger(false);
+      }
+      
+      app_regs.REG_SOURCE = reg;
+      app_install_handlers();
+      update_outputs(true, false);
+   }
+   
+   return true;
+}
+
+
+
+/************************************************************************/
+/* REG_CHANNEL_SEL                                                      */
+/************************************************************************/
+void app_read_REG_CHANNEL_SEL(void)
+{
+	if (!app_source_is_host(app_regs.REG_SOURCE))
+   {
+      app_regs.REG_CHANNEL_SEL = app_read_outputs();
+   }      
+}
+
+bool app_write_REG_CHANNEL_SEL(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+   
+   if (!app_source_is_host(app_regs.REG_SOURCE))
+   {
+      return false;
+   }
+         
+   if (reg != app_regs.REG_CHANNEL_SEL)
+   {
+      channel_sel_op_t op = {reg, ~reg, 0};
+      
+      modify_outputs(&op, false, 0);
+   }
+   
+   return true;
+}
+
+
+/* Read-modify-write of the host mask, applied by switch_outputs() in   */
+/* the same critical section as the decode and the commit.              */
+static bool modify_channel_sel(uint16_t set, uint16_t clear, uint16_t toggle)
+{
+   if (!app_source_is_host(app_regs.REG_SOURCE))
+   {
+      return false;
+   }
+   
+   channel_sel_op_t op = {set, clear, toggle};
+   
+   modify_outputs(&op, true, 0);
+   
+   return true;
+}
+
+
+/************************************************************************/
+/* REG_DI_STATE                                                         */
+/************************************************************************/
+void app_read_REG_DI_STATE(void)
+{
+   app_regs.REG_DI_STATE = sample_inputs() & MSK_IN_DI;
+}
+
+bool app_write_REG_DI_STATE(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_DO                                                               */
+/************************************************************************/
+void app_read_REG_DO(void)
+{
+   app_regs.REG_DO = read_DO0 ? B_DO0 : 0;
+}
+
+bool app_write_REG_DO(void *a)
+{
+   uint8_t reg = *((uint8_t*)a);
+   
+   if (reg & ~B_DO0)
+      return false;
+      
+   if (reg & B_DO0)
+   {
+      set_DO0;
+   }
+   else
+   {
+      clr_DO0;
+   }
+
+   app_regs.REG_DO = reg;
+   
+   if (streaming)
+      push_io_state(current_inputs(), 0);
+   
+   return true;
+}
+
+
+/************************************************************************/
+/* REG_RESERVED0                                                        */
+/************************************************************************/
+void app_read_REG_RESERVED0(void) {}
+bool app_write_REG_RESERVED0(void *a) { return true; }
+
+
+/************************************************************************/
+/* REG_DI4_CONF                                                         */
+/************************************************************************/
+void app_read_REG_DI4_CONF(void) {}
+bool app_write_REG_DI4_CONF(void *a)
+{
+   if (*((uint8_t*)a) & ~MSK_DI4_CONF)
+      return false;
+
+   app_regs.REG_DI4_CONF = *((uint8_t*)a);
+   app_install_handlers();
+   update_outputs(true, false);
+   return true;
+}
+
+
+/************************************************************************/
+/* REG_DO0_CONF                                                         */
+/************************************************************************/
+void app_read_REG_DO0_CONF(void) {}
+bool app_write_REG_DO0_CONF(void *a)
+{
+   if (*((uint8_t*)a) & ~MSK_DO0_CONF)
+      return false;
+
+   app_regs.REG_DO0_CONF = *((uint8_t*)a);
+   app_sync_configure();
+   app_install_handlers();
+   return true;
+}
+
+
+/************************************************************************/
+/* REG_EVNT_ENABLE                                                      */
+/************************************************************************/
+void app_read_REG_EVNT_ENABLE(void) {}
+bool app_write_REG_EVNT_ENABLE(void *a)
+{
+	app_regs.REG_EVNT_ENABLE = *((uint8_t*)a);
+	app_install_handlers();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SWITCH_POLICY                                                    */
+/************************************************************************/
+void app_read_REG_SWITCH_POLICY(void) {}
+bool app_write_REG_SWITCH_POLICY(void *a)
+{
+   if (*((uint8_t*)a) & ~MSK_SWITCH_POLICY)
+      return false;
+
+   app_regs.REG_SWITCH_POLICY = *((uint8_t*)a);
+   return true;
+}
+
+
+/************************************************************************/
+/* REG_SWITCH_DEAD_TIME                                                 */
+/************************************************************************/
+void app_read_REG_SWITCH_DEAD_TIME(void) {}
+bool app_write_REG_SWITCH_DEAD_TIME(void *a)
+{
+   uint16_t reg = *((uint16_t*)a);
+   
+   if (reg == 0 || reg > APP_DEAD_TIME_MAX_US)
+      return false;
+
+   app_regs.REG_SWITCH_DEAD_TIME = reg;
+   return true;
+}
+
+
+/************************************************************************/
+/* REG_INPUTS_PRIORITY                                                  */
+/************************************************************************/
+void app_read_REG_INPUTS_PRIORITY(void) {}
+bool app_write_REG_INPUTS_PRIORITY(void *a)
+{
+   uint8_t reg = *((uint8_t*)a);
+   
+   if (reg > GM_INPUTS_PRIORITY_HIGH)
+      return false;
+
+   app_regs.REG_INPUTS_PRIORITY = reg;
+   app_apply_inputs_priority();
+   return true;
+}
+
+
+/************************************************************************/
+/* REG_EVT_QUEUE_OVERFLOWS                                              */
+/************************************************************************/
+void app_read_REG_EVT_QUEUE_OVERFLOWS(void) {}
+bool app_write_REG_EVT_QUEUE_OVERFLOWS(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_EVT_COALESCE_WINDOW                                              */
+/************************************************************************/
+void app_read_REG_EVT_COALESCE_WINDOW(void) {}
+bool app_write_REG_EVT_COALESCE_WINDOW(void *a)
+{
+   app_regs.REG_EVT_COALESCE_WINDOW = *((uint8_t*)a);
+   app_events_set_window(app_regs.REG_EVT_COALESCE_WINDOW);
+   return true;
+}
+
+
+/************************************************************************/
+/* REG_EVT_COALESCED_EDGES                                              */
+/************************************************************************/
+void app_read_REG_EVT_COALESCED_EDGES(void) {}
+bool app_write_REG_EVT_COALESCED_EDGES(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_IO_STATE                                                         */
+/************************************************************************/
+void app_read_REG_IO_STATE(void)
+{
+   app_regs.REG_IO_STATE = io_state(sample_inputs());
+}
+
+bool app_write_REG_IO_STATE(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_SEQ_APPEND                                                       */
+/************************************************************************/
+void app_read_REG_SEQ_APPEND(void) {}
+bool app_write_REG_SEQ_APPEND(void *a)
+{
+   if (!app_sequence_append((app_sequence_entry_t*)a))
+      return false;
+   
+   for (uint8_t i = 0; i < 4; i++)
+      app_regs.REG_SEQ_APPEND[i] = ((uint16_t*)a)[i];
+   
+   return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQ_CONTROL                                                      */
+/************************************************************************/
+void app_read_REG_SEQ_CONTROL(void) {}
+bool app_write_REG_SEQ_CONTROL(void *a)
+{
+   uint8_t reg = *((uint8_t*)a);
+   
+   switch (reg)
+   {
+      case GM_SEQ_STOP:
+         app_sequence_stop();
+         break;
+      
+      case GM_SEQ_START:
+         if (!app_sequence_start())
+            return false;
+         break;
+      
+      case GM_SEQ_CLEAR:
+         app_sequence_clear();
+         break;
+      
+      default:
+         return false;
+   }
+   
+   app_regs.REG_SEQ_CONTROL = reg;
+   return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQ_STATUS                                                       */
+/************************************************************************/
+void app_read_REG_SEQ_STATUS(void)
+{
+   app_regs.REG_SEQ_STATUS = app_sequence_status();
+}
+
+bool app_write_REG_SEQ_STATUS(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_SEQ_UNDERRUNS                                                    */
+/************************************************************************/
+void app_read_REG_SEQ_UNDERRUNS(void) {}
+bool app_write_REG_SEQ_UNDERRUNS(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_ARMED_MASK                                                       */
+/************************************************************************/
+void app_read_REG_ARMED_MASK(void) {}
+bool app_write_REG_ARMED_MASK(void *a)
+{
+   if (!app_source_is_host(app_regs.REG_SOURCE))
+      return false;
+   
+   arm_trigger(false);
+   app_regs.REG_ARMED_MASK = *((uint16_t*)a);
+   arm_trigger(true);
+   return true;
+}
+
+
+/************************************************************************/
+/* REG_ARM_TRIGGER                                                      */
+/************************************************************************/
+void app_read_REG_ARM_TRIGGER(void)
+{
+   app_regs.REG_ARM_TRIGGER &= ~B_ARM_ARMED;
+   
+   if (trigger_is_armed())
+      app_regs.REG_ARM_TRIGGER |= B_ARM_ARMED;
+}
+
+bool app_write_REG_ARM_TRIGGER(void *a)
+{
+   uint8_t reg = *((uint8_t*)a) & ~B_ARM_ARMED;
+   
+   if (reg & ~(MSK_ARM_INPUT | MSK_ARM_EDGE))
+      return false;
+   
+   if ((reg & MSK_ARM_INPUT) > 4)
+      return false;
+   
+   /* A pending trigger follows the new input and edge */
+   bool armed = trigger_is_armed();
+   app_regs.REG_ARM_TRIGGER = reg;
+   arm_trigger(armed);
+   return true;
+}
+
+
+/************************************************************************/
+/* REG_CHANNEL_SET                                                      */
+/************************************************************************/
+void app_read_REG_CHANNEL_SET(void) {}
+bool app_write_REG_CHANNEL_SET(void *a)
+{
+   uint16_t reg = *((uint16_t*)a);
+   
+   if (!modify_channel_sel(reg, 0, 0))
+      return false;
    
-   if (app_regs.REG_SOURCE == GM_USB)
-   {
-      if ((app_regs.REG_DI4_CONF == GM_DI4_DIGITAL) | ((app_regs.REG_DI4_CONF == GM_DI4_ADDRESS) && ((read_ADD ? true : false) == (read_IN4 ? true : false))))
-      {         
-         PORTA_OUT = *(((uint8_t*)(&app_regs.REG_CHANNEL_SEL)) + 0);
-         PORTD_OUT = *(((uint8_t*)(&app_regs.REG_CHANNEL_SEL)) + 1);
-      }
-      else
-      {
-         PORTA_OUT = 0;
-         PORTD_OUT = 0;         
-      }
-   }
-   else // app_regs.REG_SOURCE == GM_EXTERNAL
-   {
-      if ((app_regs.REG_DI4_CONF == GM_DI4_DIGITAL) | ((app_regs.REG_DI4_CONF == GM_DI4_ADDRESS) && ((read_ADD ? true : false) == (read_IN4 ? true : false))))
-      {
-         uint8_t channel = PORTB_IN & 0x0F;
-         
-         if (channel <= 7)
-         {
-            PORTD_OUT = 0;
-            PORTA_OUT = (1 << channel);
-         }
-         else
-         {
-            PORTA_OUT = 0;
-            PORTD_OUT = (1 << (channel - 8));
-         }
-      }
-      else
-      {
-         PORTA_OUT = 0;
-         PORTD_OUT = 0;         
-      }
-   }
+   app_regs.REG_CHANNEL_SET = reg;
+   return true;
+}
+
+
+/************************************************************************/
+/* REG_CHANNEL_CLEAR                                                    */
+/************************************************************************/
+void app_read_REG_CHANNEL_CLEAR(void) {}
+bool app_write_REG_CHANNEL_CLEAR(void *a)
+{
+   uint16_t reg = *((uint16_t*)a);
    
-   *(((uint8_t*)(&new_state)) + 0) = PORTA_IN;
-   *(((uint8_t*)(&new_state)) + 1) = PORTD_IN;   
+   if (!modify_channel_sel(0, reg, 0))
+      return false;
    
-   if (current_state != new_state)
-   {
-      if (app_regs.REG_DO0_CONF == GM_DO_TGL_WHEN_CH_SEL_CHANGE)
-      {
-         if (update_DO0)
-         {
-            tgl_DO0;
-         }
-      }         
-                     
-      if ((app_regs.REG_SOURCE == GM_EXTERNAL) && (app_regs.REG_EVNT_ENABLE & B_EVT_OUTPUT_CHANNEL))
-      {
-         app_regs.REG_CHANNEL_SEL = new_state;
-         core_func_send_event(ADD_REG_CHANNEL_SEL, true);
-      }
-      
-      if ((app_regs.REG_SOURCE == GM_USB) && from_address_interrupt)
-      {
-         uint16_t temporary = app_regs.REG_CHANNEL_SEL;
-         
-         *(((uint8_t*)(&app_regs.REG_CHANNEL_SEL)) + 0) = PORTA_IN;
-         *(((uint8_t*)(&app_regs.REG_CHANNEL_SEL)) + 1) = PORTD_IN;
-         
-         if (app_regs.REG_EVNT_ENABLE & B_EVT_OUTPUT_CHANNEL)
-         {
-            core_func_send_event(ADD_REG_CHANNEL_SEL, true);
-         }
-         
-         app_regs.REG_CHANNEL_SEL = temporary;
-      }
-   }
+   app_regs.REG_CHANNEL_CLEAR = reg;
+   return true;
 }
 
+
 /************************************************************************/
-/* REG_SOURCE                                                           */
+/* REG_CHANNEL_TOGGLE                                                   */
 /************************************************************************/
-void app_read_REG_SOURCE(void) {}
-bool app_write_REG_SOURCE(void *a)
+void app_read_REG_CHANNEL_TOGGLE(void) {}
+bool app_write_REG_CHANNEL_TOGGLE(void *a)
 {
-   uint16_t reg = *((uint8_t*)a);
+   uint16_t reg = *((uint16_t*)a);
    
-   if (reg & ~MSK_SOURCE)
+   if (!modify_channel_sel(0, 0, reg))
       return false;
+   
+   app_regs.REG_CHANNEL_TOGGLE = reg;
+   return true;
+}
 
-   if (reg != app_regs.REG_SOURCE)
+
+/************************************************************************/
+/* REG_PRESETS                                                          */
+/************************************************************************/
+void app_read_REG_PRESETS(void) {}
+bool app_write_REG_PRESETS(void *a)
+{
+   /* One preset at a time, the inputs must not decode a half-written one */
+   for (uint8_t i = 0; i < 32; i++)
    {
-      update_outputs(true, false);
+      uint16_t preset = ((uint16_t*)a)[i];
+      uint8_t sreg = SREG;
+      cli();
+      app_regs.REG_PRESETS[i] = preset;
+      SREG = sreg;
    }
    
-   app_regs.REG_SOURCE = *((uint8_t*)a);
+   update_outputs(true, false);
    return true;
 }
 
 
+/************************************************************************/
+/* REG_GATE_INPUTS                                                      */
+/************************************************************************/
+void app_read_REG_GATE_INPUTS(void) {}
+bool app_write_REG_GATE_INPUTS(void *a)
+{
+   uint8_t reg = *((uint8_t*)a);
+   
+   if (reg & ~MSK_GATE_INPUTS)
+      return false;
+   
+   app_regs.REG_GATE_INPUTS = reg;
+   app_install_handlers();
+   update_outputs(true, false);
+   return true;
+}
+
 
 /************************************************************************/
-/* REG_CHANNEL_SEL                                                      */
+/* REG_SWEEP_CHANNELS                                                   */
 /************************************************************************/
-void app_read_REG_CHANNEL_SEL(void)
+void app_read_REG_SWEEP_CHANNELS(void) {}
+bool app_write_REG_SWEEP_CHANNELS(void *a)
 {
-	if (app_regs.REG_SOURCE == GM_EXTERNAL)
-   {
-      *(((uint8_t*)(&app_regs.REG_CHANNEL_SEL)) + 0) = PORTA_IN;
-      *(((uint8_t*)(&app_regs.REG_CHANNEL_SEL)) + 1) = PORTD_IN;
-   }      
+   app_regs.REG_SWEEP_CHANNELS = *((uint16_t*)a);
+   return true;
 }
 
-bool app_write_REG_CHANNEL_SEL(void *a)
+
+/************************************************************************/
+/* REG_SWEEP_DWELL                                                      */
+/************************************************************************/
+void app_read_REG_SWEEP_DWELL(void) {}
+bool app_write_REG_SWEEP_DWELL(void *a)
 {
-	uint16_t reg = *((uint16_t*)a);
+   uint32_t reg = *((uint32_t*)a);
    
-   if (app_regs.REG_SOURCE != GM_USB)
-   {
+   if (reg < APP_SWEEP_DWELL_MIN_US)
       return false;
-   }
-         
-   if (reg != app_regs.REG_CHANNEL_SEL)
-   {
-      app_regs.REG_CHANNEL_SEL = reg;
-      update_outputs(true, false);
-   }
    
+   app_regs.REG_SWEEP_DWELL = reg;
    return true;
 }
 
 
 /************************************************************************/
-/* REG_DI_STATE                                                         */
+/* REG_SWEEP_ORDER                                                      */
 /************************************************************************/
-void app_read_REG_DI_STATE(void)
+void app_read_REG_SWEEP_ORDER(void) {}
+bool app_write_REG_SWEEP_ORDER(void *a)
 {
-   app_regs.REG_DI_STATE = (PORTB_IN & 0x0F) | (read_IN4 ? B_DI4 : 0);
+   if (*((uint8_t*)a) & ~MSK_SWEEP_ORDER)
+      return false;
+   
+   app_regs.REG_SWEEP_ORDER = *((uint8_t*)a);
+   return true;
 }
 
-bool app_write_REG_DI_STATE(void *a)
+
+/************************************************************************/
+/* REG_SWEEP_SEED                                                       */
+/************************************************************************/
+void app_read_REG_SWEEP_SEED(void) {}
+bool app_write_REG_SWEEP_SEED(void *a)
 {
-   return false;
+   app_regs.REG_SWEEP_SEED = *((uint16_t*)a);
+   return true;
 }
 
 
 /************************************************************************/
-/* REG_DO                                                               */
+/* REG_SWEEP_REPEATS                                                    */
 /************************************************************************/
-void app_read_REG_DO(void)
+void app_read_REG_SWEEP_REPEATS(void) {}
+bool app_write_REG_SWEEP_REPEATS(void *a)
 {
-   app_regs.REG_DO = read_DO0 ? B_DO0 : 0;
+   app_regs.REG_SWEEP_REPEATS = *((uint16_t*)a);
+   return true;
 }
 
-bool app_write_REG_DO(void *a)
+
+/************************************************************************/
+/* REG_SWEEP_CONTROL                                                    */
+/************************************************************************/
+void app_read_REG_SWEEP_CONTROL(void)
 {
-   uint8_t reg = *((uint8_t*)a);
+   app_regs.REG_SWEEP_CONTROL = app_sweep_is_running() ? (GM_SWEEP_START | B_SWEEP_RUNNING) : GM_SWEEP_STOP;
+}
+
+bool app_write_REG_SWEEP_CONTROL(void *a)
+{
+   uint8_t reg = *((uint8_t*)a) & ~B_SWEEP_RUNNING;
    
-   if (reg & ~B_DO0)
+   if (reg & ~MSK_SWEEP_CONTROL)
       return false;
-      
-   if (reg & B_DO0)
+   
+   if (reg == GM_SWEEP_START)
    {
-      set_DO0;
+      if (!app_sweep_start())
+         return false;
    }
    else
    {
-      clr_DO0;
+      app_sweep_stop();
    }
+   
+   app_read_REG_SWEEP_CONTROL();
+   return true;
+}
 
-   app_regs.REG_DO = reg;
+
+/************************************************************************/
+/* REG_DO0_PULSE_WIDTH                                                  */
+/************************************************************************/
+void app_read_REG_DO0_PULSE_WIDTH(void) {}
+bool app_write_REG_DO0_PULSE_WIDTH(void *a)
+{
+   uint16_t reg = *((uint16_t*)a);
+   
+   if (reg == 0 || reg > APP_SYNC_PULSE_WIDTH_MAX_US)
+      return false;
+   
+   app_regs.REG_DO0_PULSE_WIDTH = reg;
+   app_sync_configure();
    return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED0                                                        */
+/* REG_DO0_CODE_UNIT                                                    */
 /************************************************************************/
-void app_read_REG_RESERVED0(void) {}
-bool app_write_REG_RESERVED0(void *a) { return true; }
+void app_read_REG_DO0_CODE_UNIT(void) {}
+bool app_write_REG_DO0_CODE_UNIT(void *a)
+{
+   uint16_t reg = *((uint16_t*)a);
+   
+   if (reg < APP_SYNC_CODE_UNIT_MIN_US || reg > APP_SYNC_CODE_UNIT_MAX_US)
+      return false;
+   
+   app_regs.REG_DO0_CODE_UNIT = reg;
+   app_sync_configure();
+   return true;
+}
 
 
 /************************************************************************/
-/* REG_DI4_CONF                                                         */
+/* REG_DEGLITCH_TIME                                                    */
 /************************************************************************/
-void app_read_REG_DI4_CONF(void) {}
-bool app_write_REG_DI4_CONF(void *a)
+void app_read_REG_DEGLITCH_TIME(void) {}
+bool app_write_REG_DEGLITCH_TIME(void *a)
 {
-   if (*((uint8_t*)a) & ~MSK_DI4_CONF)
+   uint16_t reg = *((uint16_t*)a);
+   
+   if (reg > APP_DEGLITCH_TIME_MAX_US)
       return false;
+   
+   app_regs.REG_DEGLITCH_TIME = reg;
+   
+   for (uint8_t i = 0; i < 6; i++)
+      app_regs.REG_DEGLITCH_REJECTS[i] = 0;
+   
+   app_deglitch_configure();
+   app_install_handlers();
+   
+   /* An edge still held by the previous filter time is handled now */
+   app_resync_inputs();
+   return true;
+}
 
-   app_regs.REG_DI4_CONF = *((uint8_t*)a);
-   update_outputs(true, false);
+
+/************************************************************************/
+/* REG_DEGLITCH_REJECTS                                                 */
+/************************************************************************/
+void app_read_REG_DEGLITCH_REJECTS(void) {}
+bool app_write_REG_DEGLITCH_REJECTS(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_STREAM_KEEPALIVE                                                 */
+/************************************************************************/
+void app_read_REG_STREAM_KEEPALIVE(void) {}
+bool app_write_REG_STREAM_KEEPALIVE(void *a)
+{
+   app_regs.REG_STREAM_KEEPALIVE = *((uint16_t*)a);
    return true;
 }
 
 
 /************************************************************************/
-/* REG_DO0_CONF                                                         */
+/* REG_EDGE_HISTORY                                                     */
 /************************************************************************/
-void app_read_REG_DO0_CONF(void) {}
-bool app_write_REG_DO0_CONF(void *a)
+void app_read_REG_EDGE_HISTORY(void) {}
+bool app_write_REG_EDGE_HISTORY(void *a)
 {
-   if (*((uint8_t*)a) & ~MSK_DO0_CONF)
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_EDGE_HEAD                                                        */
+/************************************************************************/
+void app_read_REG_EDGE_HEAD(void) {}
+bool app_write_REG_EDGE_HEAD(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_EDGE_TAIL                                                        */
+/************************************************************************/
+void app_read_REG_EDGE_TAIL(void) {}
+bool app_write_REG_EDGE_TAIL(void *a)
+{
+   uint8_t reg = *((uint8_t*)a);
+   
+   if (reg & ~MSK_EDGE_INDEX)
       return false;
+   
+   /* The input interrupts must see the new tail and flag together */
+   uint8_t sreg = SREG;
+   cli();
+   app_regs.REG_EDGE_TAIL = reg;
+   app_regs.REG_EDGE_HEAD &= ~B_EDGE_OVERFLOW;
+   SREG = sreg;
+   
+   return true;
+}
 
-   app_regs.REG_DO0_CONF = *((uint8_t*)a);
+
+/************************************************************************/
+/* REG_LATENCY_EXTERNAL                                                 */
+/************************************************************************/
+void app_read_REG_LATENCY_EXTERNAL(void) {}
+bool app_write_REG_LATENCY_EXTERNAL(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_LATENCY_USB                                                      */
+/************************************************************************/
+void app_read_REG_LATENCY_USB(void) {}
+bool app_write_REG_LATENCY_USB(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_LATENCY_CLEAR                                                    */
+/************************************************************************/
+void app_read_REG_LATENCY_CLEAR(void) {}
+bool app_write_REG_LATENCY_CLEAR(void *a)
+{
+   uint8_t reg = *((uint8_t*)a);
+   
+   if (reg & ~(B_LATENCY_CLR_EXTERNAL | B_LATENCY_CLR_USB))
+      return false;
+   
+   /* One bin at a time, the binning only needs each bin to be atomic */
+   for (uint8_t i = 0; i < 16; i++)
+   {
+      uint8_t sreg = SREG;
+      cli();
+      if (reg & B_LATENCY_CLR_EXTERNAL)
+         app_regs.REG_LATENCY_EXTERNAL[i] = 0;
+      if (reg & B_LATENCY_CLR_USB)
+         app_regs.REG_LATENCY_USB[i] = 0;
+      SREG = sreg;
+   }
+   
+   app_regs.REG_LATENCY_CLEAR = reg;
    return true;
 }
 
 
 /************************************************************************/
-/* REG_EVNT_ENABLE                                                      */
+/* REG_CHANNEL_ACTIVATIONS                                              */
 /************************************************************************/
-void app_read_REG_EVNT_ENABLE(void) {}
-bool app_write_REG_EVNT_ENABLE(void *a)
+void app_read_REG_CHANNEL_ACTIVATIONS(void) {}
+bool app_write_REG_CHANNEL_ACTIVATIONS(void *a)
 {
-	app_regs.REG_EVNT_ENABLE = *((uint8_t*)a);
-	return true;
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_CHANNEL_ON_TIME                                                  */
+/************************************************************************/
+void app_read_REG_CHANNEL_ON_TIME(void) {}
+bool app_write_REG_CHANNEL_ON_TIME(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_EVT_SUPPRESSED                                                   */
+/************************************************************************/
+void app_read_REG_EVT_SUPPRESSED(void) {}
+bool app_write_REG_EVT_SUPPRESSED(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_SILENT_SWITCHES                                                  */
+/************************************************************************/
+void app_read_REG_SILENT_SWITCHES(void) {}
+bool app_write_REG_SILENT_SWITCHES(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_SNAPSHOT                                                         */
+/************************************************************************/
+/* The live registers are sampled with interrupts disabled, so the      */
+/* outputs, inputs and DO0 are read at the same instant                 */
+void app_read_REG_SNAPSHOT(void)
+{
+   uint8_t sreg = SREG;
+   cli();
+   
+   app_read_REG_CHANNEL_SEL();
+   app_read_REG_DI_STATE();
+   app_read_REG_DO();
+   
+   app_regs.REG_SNAPSHOT[0] = app_regs.REG_SOURCE;
+   app_regs.REG_SNAPSHOT[1] = *(((uint8_t*)(&app_regs.REG_CHANNEL_SEL)) + 0);
+   app_regs.REG_SNAPSHOT[2] = *(((uint8_t*)(&app_regs.REG_CHANNEL_SEL)) + 1);
+   app_regs.REG_SNAPSHOT[3] = app_regs.REG_DI_STATE;
+   app_regs.REG_SNAPSHOT[4] = app_regs.REG_DO;
+   app_regs.REG_SNAPSHOT[5] = app_regs.REG_RESERVED0;
+   app_regs.REG_SNAPSHOT[6] = app_regs.REG_DI4_CONF;
+   app_regs.REG_SNAPSHOT[7] = app_regs.REG_DO0_CONF;
+   app_regs.REG_SNAPSHOT[8] = app_regs.REG_EVNT_ENABLE;
+   
+   SREG = sreg;
+}
+
+bool app_write_REG_SNAPSHOT(void *a)
+{
+   return false;
+}
+
+
+/************************************************************************/
+/* REG_CONFIG_CRC                                                       */
+/************************************************************************/
+void app_read_REG_CONFIG_CRC(void) {}
+bool app_write_REG_CONFIG_CRC(void *a)
+{
+   return false;
 }
\ No newline at end of file
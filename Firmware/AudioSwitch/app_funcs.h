@@ -1,6 +1,7 @@
 #ifndef _APP_FUNCTIONS_H_
 #define _APP_FUNCTIONS_H_
 #include <avr/io.h>
+#include "hwbp_core.h"
 
 
 /************************************************************************/
@@ -28,6 +29,47 @@ void app_read_REG_RESERVED0(void);
 void app_read_REG_DI4_CONF(void);
 void app_read_REG_DO0_CONF(void);
 void app_read_REG_EVNT_ENABLE(void);
+void app_read_REG_SWITCH_POLICY(void);
+void app_read_REG_SWITCH_DEAD_TIME(void);
+void app_read_REG_INPUTS_PRIORITY(void);
+void app_read_REG_EVT_QUEUE_OVERFLOWS(void);
+void app_read_REG_EVT_COALESCE_WINDOW(void);
+void app_read_REG_EVT_COALESCED_EDGES(void);
+void app_read_REG_IO_STATE(void);
+void app_read_REG_SEQ_APPEND(void);
+void app_read_REG_SEQ_CONTROL(void);
+void app_read_REG_SEQ_STATUS(void);
+void app_read_REG_SEQ_UNDERRUNS(void);
+void app_read_REG_ARMED_MASK(void);
+void app_read_REG_ARM_TRIGGER(void);
+void app_read_REG_CHANNEL_SET(void);
+void app_read_REG_CHANNEL_CLEAR(void);
+void app_read_REG_CHANNEL_TOGGLE(void);
+void app_read_REG_PRESETS(void);
+void app_read_REG_GATE_INPUTS(void);
+void app_read_REG_SWEEP_CHANNELS(void);
+void app_read_REG_SWEEP_DWELL(void);
+void app_read_REG_SWEEP_ORDER(void);
+void app_read_REG_SWEEP_SEED(void);
+void app_read_REG_SWEEP_REPEATS(void);
+void app_read_REG_SWEEP_CONTROL(void);
+void app_read_REG_DO0_PULSE_WIDTH(void);
+void app_read_REG_DO0_CODE_UNIT(void);
+void app_read_REG_DEGLITCH_TIME(void);
+void app_read_REG_DEGLITCH_REJECTS(void);
+void app_read_REG_STREAM_KEEPALIVE(void);
+void app_read_REG_EDGE_HISTORY(void);
+void app_read_REG_EDGE_HEAD(void);
+void app_read_REG_EDGE_TAIL(void);
+void app_read_REG_LATENCY_EXTERNAL(void);
+void app_read_REG_LATENCY_USB(void);
+void app_read_REG_LATENCY_CLEAR(void);
+void app_read_REG_CHANNEL_ACTIVATIONS(void);
+void app_read_REG_CHANNEL_ON_TIME(void);
+void app_read_REG_EVT_SUPPRESSED(void);
+void app_read_REG_SILENT_SWITCHES(void);
+void app_read_REG_SNAPSHOT(void);
+void app_read_REG_CONFIG_CRC(void);
 
 bool app_write_REG_SOURCE(void *a);
 bool app_write_REG_CHANNEL_SEL(void *a);
@@ -37,6 +79,102 @@ bool app_write_REG_RESERVED0(void *a);
 bool app_write_REG_DI4_CONF(void *a);
 bool app_write_REG_DO0_CONF(void *a);
 bool app_write_REG_EVNT_ENABLE(void *a);
+bool app_write_REG_SWITCH_POLICY(void *a);
+bool app_write_REG_SWITCH_DEAD_TIME(void *a);
+bool app_write_REG_INPUTS_PRIORITY(void *a);
+bool app_write_REG_EVT_QUEUE_OVERFLOWS(void *a);
+bool app_write_REG_EVT_COALESCE_WINDOW(void *a);
+bool app_write_REG_EVT_COALESCED_EDGES(void *a);
+bool app_write_REG_IO_STATE(void *a);
+bool app_write_REG_SEQ_APPEND(void *a);
+bool app_write_REG_SEQ_CONTROL(void *a);
+bool app_write_REG_SEQ_STATUS(void *a);
+bool app_write_REG_SEQ_UNDERRUNS(void *a);
+bool app_write_REG_ARMED_MASK(void *a);
+bool app_write_REG_ARM_TRIGGER(void *a);
+bool app_write_REG_CHANNEL_SET(void *a);
+bool app_write_REG_CHANNEL_CLEAR(void *a);
+bool app_write_REG_CHANNEL_TOGGLE(void *a);
+bool app_write_REG_PRESETS(void *a);
+bool app_write_REG_GATE_INPUTS(void *a);
+bool app_write_REG_SWEEP_CHANNELS(void *a);
+bool app_write_REG_SWEEP_DWELL(void *a);
+bool app_write_REG_SWEEP_ORDER(void *a);
+bool app_write_REG_SWEEP_SEED(void *a);
+bool app_write_REG_SWEEP_REPEATS(void *a);
+bool app_write_REG_SWEEP_CONTROL(void *a);
+bool app_write_REG_DO0_PULSE_WIDTH(void *a);
+bool app_write_REG_DO0_CODE_UNIT(void *a);
+bool app_write_REG_DEGLITCH_TIME(void *a);
+bool app_write_REG_DEGLITCH_REJECTS(void *a);
+bool app_write_REG_STREAM_KEEPALIVE(void *a);
+bool app_write_REG_EDGE_HISTORY(void *a);
+bool app_write_REG_EDGE_HEAD(void *a);
+bool app_write_REG_EDGE_TAIL(void *a);
+bool app_write_REG_LATENCY_EXTERNAL(void *a);
+bool app_write_REG_LATENCY_USB(void *a);
+bool app_write_REG_LATENCY_CLEAR(void *a);
+bool app_write_REG_CHANNEL_ACTIVATIONS(void *a);
+bool app_write_REG_CHANNEL_ON_TIME(void *a);
+bool app_write_REG_EVT_SUPPRESSED(void *a);
+bool app_write_REG_SILENT_SWITCHES(void *a);
+bool app_write_REG_SNAPSHOT(void *a);
+bool app_write_REG_CONFIG_CRC(void *a);
+
+
+/************************************************************************/
+/* Input handlers                                                       */
+/************************************************************************/
+void app_install_handlers(void);
+void app_sample_inputs(void);
+void app_resync_inputs(void);
+void app_set_standby(bool enable);
+void app_set_streaming(bool enable);
+void app_stream_tick_1ms(void);
+void app_apply_inputs_priority(void);
+uint8_t app_inputs_int_level(void);
+void app_stats_tick_1ms(void);
+void app_update_config_crc(void);
+bool app_config_crc_stale(void);
+void app_config_changed(void);
+void app_config_written(uint8_t add);
+
+/* Limited by the 16 bits of TCE0 at 4 MHz */
+#define APP_DEGLITCH_TIME_MAX_US 16000
+
+void app_deglitch_configure(void);
+void app_deglitch_service(void);
+
+
+/************************************************************************/
+/* Switch latency                                                       */
+/************************************************************************/
+#define APP_LATENCY_EXTERNAL 1
+#define APP_LATENCY_USB      2
+
+uint8_t app_latency_start(uint8_t path);
+uint8_t app_latency_start_at(uint8_t path, uint16_t count);
+void app_latency_stop(uint8_t path, uint8_t nested);
+
+
+/************************************************************************/
+/* Output commit stage                                                  */
+/************************************************************************/
+/* Limited by the 16 bits of TCD0 at 4 MHz */
+#define APP_DEAD_TIME_MAX_US 16000
+
+uint16_t app_read_outputs(void);
+void app_commit_outputs(uint16_t enable);
+void app_complete_break_before_make(void);
+
+
+/************************************************************************/
+/* Autonomous sources                                                   */
+/************************************************************************/
+/* Sources where the host writes REG_CHANNEL_SEL */
+#define app_source_is_host(source) ((source) == GM_USB || (source) == GM_USB_GATED)
+
+void app_set_channel_sel(uint16_t mask, const timestamp_t *when);
 
 
 #endif /* _APP_FUNCTIONS_H_ */
\ No newline at end of file
@@ -74,7 +74,48 @@ uint8_t app_regs_type[] = {
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
-	TYPE_U8
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U32,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U32,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U32,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16
 };
 
 uint16_t app_regs_n_elements[] = {
@@ -85,6 +126,47 @@ uint16_t app_regs_n_elements[] = {
 	1,
 	1,
 	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	3,
+	1,
+	4,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	32,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	6,
+	1,
+	32,
+	1,
+	1,
+	16,
+	16,
+	1,
+	16,
+	16,
+	2,
+	1,
+	9,
 	1
 };
 
@@ -96,5 +178,46 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_RESERVED0),
 	(uint8_t*)(&app_regs.REG_DI4_CONF),
 	(uint8_t*)(&app_regs.REG_DO0_CONF),
-	(uint8_t*)(&app_regs.REG_EVNT_ENABLE)
+	(uint8_t*)(&app_regs.REG_EVNT_ENABLE),
+	(uint8_t*)(&app_regs.REG_SWITCH_POLICY),
+	(uint8_t*)(&app_regs.REG_SWITCH_DEAD_TIME),
+	(uint8_t*)(&app_regs.REG_INPUTS_PRIORITY),
+	(uint8_t*)(&app_regs.REG_EVT_QUEUE_OVERFLOWS),
+	(uint8_t*)(&app_regs.REG_EVT_COALESCE_WINDOW),
+	(uint8_t*)(app_regs.REG_EVT_COALESCED_EDGES),
+	(uint8_t*)(&app_regs.REG_IO_STATE),
+	(uint8_t*)(app_regs.REG_SEQ_APPEND),
+	(uint8_t*)(&app_regs.REG_SEQ_CONTROL),
+	(uint8_t*)(&app_regs.REG_SEQ_STATUS),
+	(uint8_t*)(&app_regs.REG_SEQ_UNDERRUNS),
+	(uint8_t*)(&app_regs.REG_ARMED_MASK),
+	(uint8_t*)(&app_regs.REG_ARM_TRIGGER),
+	(uint8_t*)(&app_regs.REG_CHANNEL_SET),
+	(uint8_t*)(&app_regs.REG_CHANNEL_CLEAR),
+	(uint8_t*)(&app_regs.REG_CHANNEL_TOGGLE),
+	(uint8_t*)(app_regs.REG_PRESETS),
+	(uint8_t*)(&app_regs.REG_GATE_INPUTS),
+	(uint8_t*)(&app_regs.REG_SWEEP_CHANNELS),
+	(uint8_t*)(&app_regs.REG_SWEEP_DWELL),
+	(uint8_t*)(&app_regs.REG_SWEEP_ORDER),
+	(uint8_t*)(&app_regs.REG_SWEEP_SEED),
+	(uint8_t*)(&app_regs.REG_SWEEP_REPEATS),
+	(uint8_t*)(&app_regs.REG_SWEEP_CONTROL),
+	(uint8_t*)(&app_regs.REG_DO0_PULSE_WIDTH),
+	(uint8_t*)(&app_regs.REG_DO0_CODE_UNIT),
+	(uint8_t*)(&app_regs.REG_DEGLITCH_TIME),
+	(uint8_t*)(app_regs.REG_DEGLITCH_REJECTS),
+	(uint8_t*)(&app_regs.REG_STREAM_KEEPALIVE),
+	(uint8_t*)(app_regs.REG_EDGE_HISTORY),
+	(uint8_t*)(&app_regs.REG_EDGE_HEAD),
+	(uint8_t*)(&app_regs.REG_EDGE_TAIL),
+	(uint8_t*)(app_regs.REG_LATENCY_EXTERNAL),
+	(uint8_t*)(app_regs.REG_LATENCY_USB),
+	(uint8_t*)(&app_regs.REG_LATENCY_CLEAR),
+	(uint8_t*)(app_regs.REG_CHANNEL_ACTIVATIONS),
+	(uint8_t*)(app_regs.REG_CHANNEL_ON_TIME),
+	(uint8_t*)(app_regs.REG_EVT_SUPPRESSED),
+	(uint8_t*)(&app_regs.REG_SILENT_SWITCHES),
+	(uint8_t*)(app_regs.REG_SNAPSHOT),
+	(uint8_t*)(&app_regs.REG_CONFIG_CRC)
 };
\ No newline at end of file
@@ -157,6 +157,47 @@ typedef struct
 	uint8_t REG_DI4_CONF;
 	uint8_t REG_DO0_CONF;
 	uint8_t REG_EVNT_ENABLE;
+	uint8_t REG_SWITCH_POLICY;
+	uint16_t REG_SWITCH_DEAD_TIME;
+	uint8_t REG_INPUTS_PRIORITY;
+	uint16_t REG_EVT_QUEUE_OVERFLOWS;
+	uint8_t REG_EVT_COALESCE_WINDOW;
+	uint16_t REG_EVT_COALESCED_EDGES[3];
+	uint32_t REG_IO_STATE;
+	uint16_t REG_SEQ_APPEND[4];
+	uint8_t REG_SEQ_CONTROL;
+	uint8_t REG_SEQ_STATUS;
+	uint16_t REG_SEQ_UNDERRUNS;
+	uint16_t REG_ARMED_MASK;
+	uint8_t REG_ARM_TRIGGER;
+	uint16_t REG_CHANNEL_SET;
+	uint16_t REG_CHANNEL_CLEAR;
+	uint16_t REG_CHANNEL_TOGGLE;
+	uint16_t REG_PRESETS[32];
+	uint8_t REG_GATE_INPUTS;
+	uint16_t REG_SWEEP_CHANNELS;
+	uint32_t REG_SWEEP_DWELL;
+	uint8_t REG_SWEEP_ORDER;
+	uint16_t REG_SWEEP_SEED;
+	uint16_t REG_SWEEP_REPEATS;
+	uint8_t REG_SWEEP_CONTROL;
+	uint16_t REG_DO0_PULSE_WIDTH;
+	uint16_t REG_DO0_CODE_UNIT;
+	uint16_t REG_DEGLITCH_TIME;
+	uint16_t REG_DEGLITCH_REJECTS[6];
+	uint16_t REG_STREAM_KEEPALIVE;
+	uint32_t REG_EDGE_HISTORY[32];
+	uint8_t REG_EDGE_HEAD;
+	uint8_t REG_EDGE_TAIL;
+	uint16_t REG_LATENCY_EXTERNAL[16];
+	uint16_t REG_LATENCY_USB[16];
+	uint8_t REG_LATENCY_CLEAR;
+	uint32_t REG_CHANNEL_ACTIVATIONS[16];
+	uint32_t REG_CHANNEL_ON_TIME[16];
+	uint16_t REG_EVT_SUPPRESSED[2];
+	uint16_t REG_SILENT_SWITCHES;
+	uint8_t REG_SNAPSHOT[9];
+	uint16_t REG_CONFIG_CRC;
 } AppRegs;
 
 /************************************************************************/
@@ -171,6 +212,47 @@ typedef struct
 #define ADD_REG_DI4_CONF                    37 // U8     Configuration of digital input 4 (DI4)functionality
 #define ADD_REG_DO0_CONF                    38 // U8     Configuration of the digital output 0 (DO0) funtionality
 #define ADD_REG_EVNT_ENABLE                 39 // U8     Enable the Events
+#define ADD_REG_SWITCH_POLICY               40 // U8     Policy used to commit a new channel mask to the outputs
+#define ADD_REG_SWITCH_DEAD_TIME            41 // U16    Dead time of the break-before-make policy [us]
+#define ADD_REG_INPUTS_PRIORITY             42 // U8     Interrupt priority of the switching inputs
+#define ADD_REG_EVT_QUEUE_OVERFLOWS         43 // U16    Number of events lost because the event queue was full
+#define ADD_REG_EVT_COALESCE_WINDOW         44 // U8     Window used to coalesce the events [ms]
+#define ADD_REG_EVT_COALESCED_EDGES         45 // U16[3] Edges folded into the last CHANNEL_SEL, DI_STATE and IO_STATE events
+#define ADD_REG_IO_STATE                    46 // U32    Combined state of the inputs, outputs and DO0
+#define ADD_REG_SEQ_APPEND                  47 // U16[4] Appends an entry (second, second, 32 us, mask) to the sequence
+#define ADD_REG_SEQ_CONTROL                 48 // U8     Starts, stops or clears the sequence
+#define ADD_REG_SEQ_STATUS                  49 // U8     Entries pending and running state of the sequence
+#define ADD_REG_SEQ_UNDERRUNS               50 // U16    Number of sequence entries applied late
+#define ADD_REG_ARMED_MASK                  51 // U16    Channel mask applied on the trigger edge
+#define ADD_REG_ARM_TRIGGER                 52 // U8     Input and edge that apply the armed mask
+#define ADD_REG_CHANNEL_SET                 53 // U16    Enables the channels set in the mask
+#define ADD_REG_CHANNEL_CLEAR               54 // U16    Disables the channels set in the mask
+#define ADD_REG_CHANNEL_TOGGLE              55 // U16    Toggles the channels set in the mask
+#define ADD_REG_PRESETS                     56 // U16[32] Channel masks selected by the external address
+#define ADD_REG_GATE_INPUTS                 57 // U8     Inputs that gate the host mask in the gated USB source
+#define ADD_REG_SWEEP_CHANNELS              58 // U16    Channels enabled one at a time by the sweep
+#define ADD_REG_SWEEP_DWELL                 59 // U32    Time each channel of the sweep is enabled [us]
+#define ADD_REG_SWEEP_ORDER                 60 // U8     Order of the channels in each pass of the sweep
+#define ADD_REG_SWEEP_SEED                  61 // U16    Seed of the random order of the sweep
+#define ADD_REG_SWEEP_REPEATS               62 // U16    Number of passes of the sweep (0 repeats until stopped)
+#define ADD_REG_SWEEP_CONTROL               63 // U8     Starts or stops the sweep
+#define ADD_REG_DO0_PULSE_WIDTH             64 // U16    Width of the DO0 pulse on channel change [us]
+#define ADD_REG_DO0_CODE_UNIT               65 // U16    Time unit of the DO0 channel code [us]
+#define ADD_REG_DEGLITCH_TIME               66 // U16    Time the inputs must be stable before they are used [us]
+#define ADD_REG_DEGLITCH_REJECTS            67 // U16[6] Glitches rejected on IN0-IN4 and ADD
+#define ADD_REG_STREAM_KEEPALIVE            68 // U16    Period of the IO_STATE keep-alive in Speed Mode (ms)
+#define ADD_REG_EDGE_HISTORY                69 // U32[32] Ring of the last input edges, two words per edge
+#define ADD_REG_EDGE_HEAD                   70 // U8     Entry written by the next input edge
+#define ADD_REG_EDGE_TAIL                   71 // U8     First entry not read by the host
+#define ADD_REG_LATENCY_EXTERNAL            72 // U16[16] Switch latency histogram of the input edges
+#define ADD_REG_LATENCY_USB                 73 // U16[16] Switch latency histogram of the host writes
+#define ADD_REG_LATENCY_CLEAR               74 // U8     Clears the latency histograms
+#define ADD_REG_CHANNEL_ACTIVATIONS         75 // U32[16] Times each channel was enabled
+#define ADD_REG_CHANNEL_ON_TIME             76 // U32[16] Time each channel was enabled (ms)
+#define ADD_REG_EVT_SUPPRESSED              77 // U16[2] Switches and DI changes not reported due to REG_EVNT_ENABLE
+#define ADD_REG_SILENT_SWITCHES             78 // U16    Switches without a matching event
+#define ADD_REG_SNAPSHOT                    79 // U8[9]  Registers 32 to 39 (CHANNEL_SEL as two bytes) read at once
+#define ADD_REG_CONFIG_CRC                  80 // U16    CRC-16 of the configuration registers
 
 /************************************************************************/
 /* PWM Generator registers' memory limits                               */
@@ -180,15 +262,17 @@ typedef struct
 /************************************************************************/
 /* Memory limits */
 #define APP_REGS_ADD_MIN                    0x20
-#define APP_REGS_ADD_MAX                    0x27
-#define APP_NBYTES_OF_REG_BANK              9
+#define APP_REGS_ADD_MAX                    0x50
+#define APP_NBYTES_OF_REG_BANK              484
 
 /************************************************************************/
 /* Registers' bits                                                      */
 /************************************************************************/
-#define MSK_SOURCE                         (1<<0)       // 
+#define MSK_SOURCE                         (3<<0)       // 
 #define GM_USB                             (0<<0)       // Device is controlled by a host computer
 #define GM_EXTERNAL                        (1<<0)       // Device is  controlled by the digital inputs
+#define GM_EXTERNAL_PRESETS                (2<<0)       // The digital inputs select one of the REG_PRESETS masks
+#define GM_USB_GATED                       (3<<0)       // Device is controlled by a host computer, gated by REG_GATE_INPUTS
 #define B_DI0                              (1<<0)       // 
 #define B_DI1                              (1<<1)       // 
 #define B_DI2                              (1<<2)       // 
@@ -198,10 +282,50 @@ typedef struct
 #define MSK_DI4_CONF                       (1<<0)       // 
 #define GM_DI4_DIGITAL                     (0<<0)       // 
 #define GM_DI4_ADDRESS                     (1<<0)       // 
-#define MSK_DO0_CONF                       (1<<0)       // 
+#define MSK_DO0_CONF                       (3<<0)       // 
 #define GM_DO_DIGITAL                      (0<<0)       // 
 #define GM_DO_TGL_WHEN_CH_SEL_CHANGE       (1<<0)       // 
+#define GM_DO_PULSE_WHEN_CH_SEL_CHANGE     (2<<0)       // Pulse of REG_DO0_PULSE_WIDTH timed by TCC0
+#define GM_DO_CODE_WHEN_CH_SEL_CHANGE      (3<<0)       // Serial code of the new mask timed by TCC0
 #define B_EVT_OUTPUT_CHANNEL               (1<<0)       // Event of register CHANNEL_SEL
 #define B_EVT_DI_STATE                     (1<<1)       // Event of register DI_STATE
+#define B_EVT_IO_STATE                     (1<<2)       // Send the events above as events of register IO_STATE
+#define B_EVT_COALESCED_EDGES              (1<<3)       // Event of register EVT_COALESCED_EDGES
+#define MSK_SWITCH_POLICY                  (1<<0)       // 
+#define GM_SWITCH_SIMULTANEOUS             (0<<0)       // Both output ports are written back-to-back with interrupts disabled
+#define GM_SWITCH_BREAK_BEFORE_MAKE        (1<<0)       // Channels are disabled first and enabled after the dead time
+#define MSK_INPUTS_PRIORITY                (3<<0)       // 
+#define GM_INPUTS_PRIORITY_LOW             (0<<0)       // Inputs interrupt at INT_LEVEL_LOW
+#define GM_INPUTS_PRIORITY_MEDIUM          (1<<0)       // Inputs interrupt at INT_LEVEL_MED
+#define GM_INPUTS_PRIORITY_HIGH            (2<<0)       // Inputs interrupt at INT_LEVEL_HIGH
+#define MSK_IO_STATE_CHANNELS              (0xFFFFUL<<0)  // Enabled channels (EN0-EN15)
+#define MSK_IO_STATE_DI                    (0x1FUL<<16)   // Same as DI_STATE
+#define B_IO_STATE_DO0                     (1UL<<24)      // State of DO0
+#define MSK_SEQ_CONTROL                    (3<<0)       // 
+#define GM_SEQ_STOP                        (0<<0)       // Stops the sequence, keeping the pending entries
+#define GM_SEQ_START                       (1<<0)       // Starts or resumes the sequence (host sources only)
+#define GM_SEQ_CLEAR                       (2<<0)       // Stops the sequence and discards the pending entries
+#define MSK_SEQ_PENDING                    (0x3F<<0)    // Number of entries pending
+#define B_SEQ_RUNNING                      (1<<7)       // The sequence is running
+#define MSK_ARM_INPUT                      (7<<0)       // Input that triggers the armed mask (0 to 4 for DI0 to DI4)
+#define MSK_ARM_EDGE                       (3<<4)       // 
+#define GM_ARM_EDGE_RISING                 (1<<4)       // 
+#define GM_ARM_EDGE_FALLING                (2<<4)       // 
+#define GM_ARM_EDGE_BOTH                   (3<<4)       // 
+#define B_ARM_ARMED                        (1<<7)       // Read only, set while the armed mask waits for the trigger
+#define MSK_GATE_INPUTS                    (0x1F<<0)    // Same bits as DI_STATE
+#define MSK_SWEEP_ORDER                    (1<<0)       // 
+#define GM_SWEEP_SEQUENTIAL                (0<<0)       // From the lowest to the highest channel
+#define GM_SWEEP_RANDOM                    (1<<0)       // Shuffled on every pass from REG_SWEEP_SEED
+#define MSK_SWEEP_CONTROL                  (1<<0)       // 
+#define GM_SWEEP_STOP                      (0<<0)       // Stops the sweep, keeping the current channel
+#define GM_SWEEP_START                     (1<<0)       // Starts the sweep from the first channel (host sources only)
+#define B_SWEEP_RUNNING                    (1<<7)       // Read only, set while the sweep runs
+#define MSK_EDGE_USECOND                   (0xFFFFUL<<0)  // Second word of an edge: R_TIMESTAMP_MICRO (32 us units)
+#define MSK_EDGE_INPUTS                    (0x3FUL<<16)   // Second word of an edge: IN0-IN4 and ADD after the edge
+#define MSK_EDGE_INDEX                     (0x0F<<0)    // Entry of REG_EDGE_HISTORY (0 to 15)
+#define B_EDGE_OVERFLOW                    (1<<7)       // Read only, set when edges were dropped on a full ring
+#define B_LATENCY_CLR_EXTERNAL             (1<<0)       // Clears REG_LATENCY_EXTERNAL
+#define B_LATENCY_CLR_USB                  (1<<1)       // Clears REG_LATENCY_USB
 
 #endif /* _APP_REGS_H_ */
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include "app_sequence.h"
+#include "app_sweep.h"
+#include "app_funcs.h"
+#include "app_events.h"
+#include "app_ios_and_regs.h"
+#include "cpu.h"
+
+/************************************************************************/
+/* Declare application registers                                        */
+/************************************************************************/
+extern AppRegs app_regs;
+
+/************************************************************************/
+/* Table of pending entries                                             */
+/************************************************************************/
+/* Appended by register writes and consumed by the TCD1 interrupt.      */
+#define SEQUENCE_MASK (APP_SEQUENCE_SIZE - 1)
+
+static app_sequence_entry_t table[APP_SEQUENCE_SIZE];
+static volatile uint8_t table_head = 0;
+static volatile uint8_t table_tail = 0;
+
+static volatile bool running = false;
+
+/* Set while running with nothing to wait for, so an append restarts TCD1 */
+static volatile bool waiting = false;
+
+/* R_TIMESTAMP_MICRO counts 32 us, the same as TCD1 at 32 MHz / 1024 */
+#define TICKS_PER_SECOND   31250L
+#define TICKS_MAX_WAIT     60000L
+
+/* Entries reached more than 1 ms after their timestamp are underruns */
+#define TICKS_LATE         32L
+
+static void schedule(uint16_t ticks)
+{
+	timer_type1_enable(&TCD1, TIMER_PRESCALER_DIV1024, ticks, app_inputs_int_level());
+}
+
+/* Ticks of 32 us from now until the entry, saturated to the wait range */
+static int32_t ticks_until(const app_sequence_entry_t *entry, const timestamp_t *now)
+{
+	int32_t seconds = (int32_t)(entry->second - now->second);
+
+	if (seconds > 1)
+		return TICKS_MAX_WAIT;
+	if (seconds < -1)
+		return -TICKS_PER_SECOND;
+
+	return seconds * TICKS_PER_SECOND + ((int32_t)entry->usecond - now->usecond);
+}
+
+static uint8_t pending(void)
+{
+	return (table_head - table_tail) & SEQUENCE_MASK;
+}
+
+bool app_sequence_append(const app_sequence_entry_t *entry)
+{
+	uint8_t head = table_head;
+	uint8_t next = (head + 1) & SEQUENCE_MASK;
+
+	if (next == table_tail)
+		return false;
+
+	table[head] = *entry;
+
+	uint8_t sreg = SREG;
+	cli();
+	table_head = next;
+	if (running && waiting)
+	{
+		waiting = false;
+		schedule(1);
+	}
+	SREG = sreg;
+
+	return true;
+}
+
+/* Only the host mask can be sequenced */
+bool app_sequence_start(void)
+{
+	if (!app_source_is_host(app_regs.REG_SOURCE))
+		return false;
+
+	app_sweep_stop();
+
+	uint8_t sreg = SREG;
+	cli();
+	running = true;
+	waiting = false;
+	schedule(1);
+	SREG = sreg;
+
+	return true;
+}
+
+void app_sequence_stop(void)
+{
+	uint8_t sreg = SREG;
+	cli();
+	if (running)
+		timer_type1_stop(&TCD1);
+	running = false;
+	waiting = false;
+	SREG = sreg;
+}
+
+void app_sequence_clear(void)
+{
+	app_sequence_stop();
+	table_tail = table_head;
+	app_regs.REG_SEQ_UNDERRUNS = 0;
+}
+
+uint8_t app_sequence_status(void)
+{
+	return pending() | (running ? B_SEQ_RUNNING : 0);
+}
+
+/* Called by the TCD1 interrupt. Applies every entry that is due and    */
+/* waits for the next one.                                              */
+void app_sequence_service(void)
+{
+	timer_type1_stop(&TCD1);
+
+	if (!running)
+		return;
+
+	timestamp_t now;
+	app_events_read_timestamp(&now);
+
+	while (table_tail != table_head)
+	{
+		app_sequence_entry_t *entry = &table[table_tail];
+		int32_t ticks = ticks_until(entry, &now);
+
+		if (ticks > 0)
+		{
+			schedule(ticks);
+			return;
+		}
+
+		if (ticks < -TICKS_LATE && app_regs.REG_SEQ_UNDERRUNS != 0xFFFF)
+			app_regs.REG_SEQ_UNDERRUNS++;
+
+		app_set_channel_sel(entry->mask, &now);
+		table_tail = (table_tail + 1) & SEQUENCE_MASK;
+	}
+
+	/* Ran out of entries, report it and wait for the next append */
+	uint8_t sreg = SREG;
+	cli();
+	if (table_tail == table_head)
+		waiting = true;
+	else
+		schedule(1);
+	SREG = sreg;
+
+	app_events_push(ADD_REG_SEQ_STATUS, app_sequence_status());
+}
\ No newline at end of file
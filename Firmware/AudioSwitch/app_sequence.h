@@ -0,0 +1,37 @@
+#ifndef _APP_SEQUENCE_H_
+#define _APP_SEQUENCE_H_
+#include <avr/io.h>
+#include "hwbp_core.h"
+
+
+/************************************************************************/
+/* Channel sequence table                                               */
+/************************************************************************/
+/* Entries are (Harp timestamp, channel mask) pairs, applied to         */
+/* REG_CHANNEL_SEL when the timestamp is reached. TCD1 counts the time  */
+/* to the next entry in steps of 32 us, the resolution of the Harp      */
+/* R_TIMESTAMP_MICRO register.                                          */
+/* Must be a power of 2. One entry is always left free.                */
+#define APP_SEQUENCE_SIZE 32
+
+/* Same layout as REG_SEQ_APPEND */
+typedef struct
+{
+	uint32_t second;
+	uint16_t usecond;
+	uint16_t mask;
+} app_sequence_entry_t;
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+bool app_sequence_append(const app_sequence_entry_t *entry);
+bool app_sequence_start(void);
+void app_sequence_stop(void);
+void app_sequence_clear(void);
+uint8_t app_sequence_status(void);
+void app_sequence_service(void);
+
+
+#endif /* _APP_SEQUENCE_H_ */
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include "app_sweep.h"
+#include "app_sequence.h"
+#include "app_funcs.h"
+#include "app_events.h"
+#include "app_ios_and_regs.h"
+#include "cpu.h"
+
+/************************************************************************/
+/* Declare application registers                                        */
+/************************************************************************/
+extern AppRegs app_regs;
+
+/************************************************************************/
+/* Sweep state                                                          */
+/************************************************************************/
+static volatile bool running = false;
+
+/* REG_SWEEP_CHANNELS when the sweep started */
+static uint16_t channels;
+
+/* Channels of the current pass, in the order they are enabled */
+static uint8_t order[16];
+static uint8_t n_channels;
+static uint8_t step;
+
+/* REG_SWEEP_REPEATS at 0 sweeps until stopped */
+static bool forever;
+static uint16_t passes_left;
+
+static uint16_t rng;
+
+/* The dwell is counted as a number of TCD1 periods */
+static uint8_t prescaler;
+static uint16_t period;
+static uint16_t periods;
+static uint16_t periods_left;
+
+/* xorshift16, never returns 0 for a non-zero state */
+static uint16_t next_random(void)
+{
+	rng ^= rng << 7;
+	rng ^= rng >> 9;
+	rng ^= rng << 8;
+	return rng;
+}
+
+static void build_pass(void)
+{
+	n_channels = 0;
+
+	for (uint8_t ch = 0; ch < 16; ch++)
+		if (channels & ((uint16_t)1 << ch))
+			order[n_channels++] = ch;
+
+	if (app_regs.REG_SWEEP_ORDER != GM_SWEEP_RANDOM)
+		return;
+
+	/* Fisher-Yates, the index is scaled instead of using a division */
+	for (uint8_t i = n_channels - 1; i > 0; i--)
+	{
+		uint8_t j = ((uint32_t)next_random() * (i + 1)) >> 16;
+		uint8_t tmp = order[i];
+		order[i] = order[j];
+		order[j] = tmp;
+	}
+}
+
+/* Chooses the smallest prescaler that fits the dwell in one period.    */
+/* Above 0.5 s the dwell is split in periods of 32 us counts.           */
+static void set_dwell(uint32_t us)
+{
+	uint32_t ticks;
+
+	periods = 1;
+
+	if (us <= 2047)
+	{
+		prescaler = TIMER_PRESCALER_DIV1;
+		ticks = us * 32;
+	}
+	else if (us <= 16383)
+	{
+		prescaler = TIMER_PRESCALER_DIV8;
+		ticks = us * 4;
+	}
+	else if (us <= 131071)
+	{
+		prescaler = TIMER_PRESCALER_DIV64;
+		ticks = us / 2;
+	}
+	else if (us <= 524287)
+	{
+		prescaler = TIMER_PRESCALER_DIV256;
+		ticks = us / 8;
+	}
+	else
+	{
+		prescaler = TIMER_PRESCALER_DIV1024;
+		ticks = us / 32;
+		periods = (ticks >> 16) + 1;
+		ticks /= periods;
+	}
+
+	period = ticks;
+}
+
+static void switch_to_step(const timestamp_t *when)
+{
+	app_set_channel_sel((uint16_t)1 << order[step], when);
+}
+
+/* Only the host mask can be swept */
+bool app_sweep_start(void)
+{
+	if (!app_source_is_host(app_regs.REG_SOURCE) || app_regs.REG_SWEEP_CHANNELS == 0)
+		return false;
+
+	app_sequence_stop();
+	app_sweep_stop();
+
+	channels = app_regs.REG_SWEEP_CHANNELS;
+	rng = app_regs.REG_SWEEP_SEED ? app_regs.REG_SWEEP_SEED : 1;
+	forever = (app_regs.REG_SWEEP_REPEATS == 0);
+	passes_left = app_regs.REG_SWEEP_REPEATS;
+	set_dwell(app_regs.REG_SWEEP_DWELL);
+
+	step = 0;
+	build_pass();
+
+	uint8_t sreg = SREG;
+	cli();
+	running = true;
+	periods_left = periods;
+	switch_to_step(0);
+	timer_type1_enable(&TCD1, prescaler, period, app_inputs_int_level());
+	SREG = sreg;
+
+	return true;
+}
+
+void app_sweep_stop(void)
+{
+	uint8_t sreg = SREG;
+	cli();
+	if (running)
+		timer_type1_stop(&TCD1);
+	running = false;
+	SREG = sreg;
+}
+
+bool app_sweep_is_running(void)
+{
+	return running;
+}
+
+/* Called by the TCD1 interrupt at the end of every period */
+void app_sweep_service(void)
+{
+	if (--periods_left)
+		return;
+
+	periods_left = periods;
+
+	timestamp_t now;
+	app_events_read_timestamp(&now);
+
+	if (++step >= n_channels)
+	{
+		step = 0;
+
+		/* Disable the channels and report the end of the sweep */
+		if (!forever && --passes_left == 0)
+		{
+			app_sweep_stop();
+			app_set_channel_sel(0, &now);
+			app_events_push_at(ADD_REG_SWEEP_CONTROL, GM_SWEEP_STOP, &now);
+			return;
+		}
+
+		build_pass();
+	}
+
+	switch_to_step(&now);
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#ifndef _APP_SWEEP_H_
+#define _APP_SWEEP_H_
+#include <avr/io.h>
+#include "hwbp_core.h"
+
+
+/************************************************************************/
+/* Channel sweep                                                        */
+/************************************************************************/
+/* Steps REG_CHANNEL_SEL through the channels of REG_SWEEP_CHANNELS,    */
+/* one at a time, every REG_SWEEP_DWELL microseconds. TCD1 is shared    */
+/* with the sequence table, so only one of them runs at a time.         */
+#define APP_SWEEP_DWELL_MIN_US 100
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+bool app_sweep_start(void);
+void app_sweep_stop(void);
+bool app_sweep_is_running(void);
+void app_sweep_service(void);
+
+
+#endif /* _APP_SWEEP_H_ */
\ No newline at end of file
@@ -0,0 +1,186 @@
+#include "app_sync.h"
+#include "app_ios_and_regs.h"
+#include "cpu.h"
+
+/************************************************************************/
+/* Declare application registers                                        */
+/************************************************************************/
+extern AppRegs app_regs;
+
+/************************************************************************/
+/* Fixed-width pulse                                                    */
+/************************************************************************/
+/* In single-slope mode OC0B is set when the counter wraps to BOTTOM    */
+/* and cleared on the CCB match. Starting with CNT at PER, the pulse    */
+/* begins on the next count and lasts CCB counts. The CCA match ends a  */
+/* low guard time as long as the pulse, so consecutive pulses never     */
+/* merge. A switch during a pulse is marked right after its guard time. */
+#define SYNC_COUNTS_PER_US 4    // 32 MHz / 8
+
+static volatile bool pulse_pending = false;
+
+/************************************************************************/
+/* Channel code                                                         */
+/************************************************************************/
+/* A start symbol, the 16 bits of the new mask (LSB first) and one idle */
+/* symbol. Every symbol lasts 4 units and is high for 3 units (start),  */
+/* 2 units (one), 1 unit (zero) or not at all (idle). The idle symbol   */
+/* keeps the line low for 4 units, longer than any low time inside a    */
+/* code (3 units), which is what the decoder needs to find the next     */
+/* start symbol. A single idle symbol is enough.                        */
+/* OC0B is set at BOTTOM and cleared on CCB, so each timer period is one */
+/* symbol. The overflow interrupt loads the next symbol to CCBBUF,      */
+/* applied by the hardware on the next period, so the code is never     */
+/* delayed by the interrupt latency.                                    */
+#define CODE_BITS         16
+#define CODE_IDLE_SYMBOLS 1
+#define CODE_SYMBOLS      (1 + CODE_BITS + CODE_IDLE_SYMBOLS)
+
+static uint16_t code_unit;
+static volatile uint16_t code_value;
+static volatile uint8_t code_symbol;
+static volatile bool code_pending = false;
+static volatile uint16_t code_next;
+
+static bool pulse_is_running(void)
+{
+	return (TCC0.CTRLA & TC_CLKSEL_gm) != TC_CLKSEL_OFF_gc;
+}
+
+static void pulse_start(void)
+{
+	TCC0.CNT = TCC0.PER;
+	TCC0.CTRLA = TC_CLKSEL_DIV8_gc;
+}
+
+static void code_start(uint16_t value)
+{
+	code_value = value;
+	code_symbol = 0;
+	TCC0.CCB = code_unit * 3;
+	TCC0.CCBBUF = code_unit * 3;
+	TCC0.CNT = TCC0.PER;
+	TCC0.CTRLA = TC_CLKSEL_DIV8_gc;
+}
+
+/* Must be called every time REG_DO0_CONF, REG_DO0_PULSE_WIDTH or       */
+/* REG_DO0_CODE_UNIT changes                                            */
+void app_sync_configure(void)
+{
+	uint8_t sreg = SREG;
+	cli();
+
+	TCC0.CTRLA = TC_CLKSEL_OFF_gc;
+	TCC0.INTCTRLA = 0;
+	TCC0.INTCTRLB = 0;
+	TCC0.CTRLB = 0;
+	TCC0.INTFLAGS = TC0_CCAIF_bm | TC0_OVFIF_bm;
+	pulse_pending = false;
+	code_pending = false;
+
+	if (app_regs.REG_DO0_CONF == GM_DO_PULSE_WHEN_CH_SEL_CHANGE)
+	{
+		uint16_t width = app_regs.REG_DO0_PULSE_WIDTH * SYNC_COUNTS_PER_US;
+
+		clr_DO0;
+		TCC0.CNT = 0;
+		TCC0.PER = 0xFFFF;
+		TCC0.CCB = width;
+		TCC0.CCA = width * 2;
+		TCC0.CTRLB = TC0_CCBEN_bm | TC_WGMODE_SS_gc;
+		TCC0.INTCTRLB = TC_CCAINTLVL_MED_gc;
+	}
+
+	if (app_regs.REG_DO0_CONF == GM_DO_CODE_WHEN_CH_SEL_CHANGE)
+	{
+		code_unit = app_regs.REG_DO0_CODE_UNIT * SYNC_COUNTS_PER_US;
+
+		clr_DO0;
+		TCC0.CNT = 0;
+		TCC0.PER = code_unit * 4 - 1;
+		TCC0.CTRLB = TC0_CCBEN_bm | TC_WGMODE_SS_gc;
+		TCC0.INTCTRLA = TC_OVFINTLVL_MED_gc;
+	}
+
+	SREG = sreg;
+}
+
+/* Called right after the outputs are written with a new mask */
+void app_sync_mark(uint16_t outputs)
+{
+	switch (app_regs.REG_DO0_CONF)
+	{
+		case GM_DO_TGL_WHEN_CH_SEL_CHANGE:
+			tgl_DO0;
+			break;
+
+		case GM_DO_PULSE_WHEN_CH_SEL_CHANGE:
+		{
+			uint8_t sreg = SREG;
+			cli();
+			if (pulse_is_running())
+				pulse_pending = true;
+			else
+				pulse_start();
+			SREG = sreg;
+			break;
+		}
+
+		/* A switch during a code is sent after it, only the latest one */
+		case GM_DO_CODE_WHEN_CH_SEL_CHANGE:
+		{
+			uint8_t sreg = SREG;
+			cli();
+			if (pulse_is_running())
+			{
+				code_next = outputs;
+				code_pending = true;
+			}
+			else
+			{
+				code_start(outputs);
+			}
+			SREG = sreg;
+			break;
+		}
+	}
+}
+
+/* Called by the TCC0 CCA interrupt at the end of the guard time */
+void app_sync_service(void)
+{
+	TCC0.CTRLA = TC_CLKSEL_OFF_gc;
+
+	if (pulse_pending)
+	{
+		pulse_pending = false;
+		pulse_start();
+	}
+}
+
+/* Called by the TCC0 overflow interrupt at the start of every symbol,  */
+/* and once more when the last idle symbol ends                         */
+void app_sync_code_service(void)
+{
+	if (code_symbol == CODE_SYMBOLS)
+	{
+		TCC0.CTRLA = TC_CLKSEL_OFF_gc;
+
+		if (code_pending)
+		{
+			code_pending = false;
+			code_start(code_next);
+		}
+		return;
+	}
+
+	/* Symbol 0 is the start, then the bits and the idle symbols */
+	uint8_t next = code_symbol + 1;
+
+	if (next <= CODE_BITS)
+		TCC0.CCBBUF = (code_value & ((uint16_t)1 << (next - 1))) ? code_unit * 2 : code_unit;
+	else
+		TCC0.CCBBUF = 0;
+
+	code_symbol++;
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#ifndef _APP_SYNC_H_
+#define _APP_SYNC_H_
+#include <avr/io.h>
+#include "hwbp_core.h"
+
+
+/************************************************************************/
+/* DO0 switch marker                                                    */
+/************************************************************************/
+/* DO0 is OC0B of TCC0, so the pulses and codes are timed by the timer  */
+/* compare and not by the instructions that follow the switch.          */
+#define APP_SYNC_PULSE_WIDTH_MAX_US 8000
+#define APP_SYNC_CODE_UNIT_MIN_US 10
+#define APP_SYNC_CODE_UNIT_MAX_US 4000
+
+
+/************************************************************************/
+/* Prototypes                                                           */
+/************************************************************************/
+void app_sync_configure(void);
+void app_sync_mark(uint16_t outputs);
+void app_sync_service(void);
+void app_sync_code_service(void);
+
+
+#endif /* _APP_SYNC_H_ */
\ No newline at end of file
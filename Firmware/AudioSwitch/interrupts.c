@@ -2,6 +2,9 @@
 #include "hwbp_core_types.h"
 #include "app_ios_and_regs.h"
 #include "app_funcs.h"
+#include "app_sequence.h"
+#include "app_sweep.h"
+#include "app_sync.h"
 #include "hwbp_core.h"
 
 /************************************************************************/
@@ -9,8 +12,6 @@
 /************************************************************************/
 extern AppRegs app_regs;
 
-extern void update_outputs(bool update_DO0, bool from_address_interrupt);
-
 /************************************************************************/
 /* Interrupts from Timers                                               */
 /************************************************************************/
@@ -29,66 +30,106 @@ extern void update_outputs(bool update_DO0, bool from_address_interrupt);
 // ISR(TCD1_CCA_vect, ISR_NAKED)
 
 /************************************************************************/ 
-/* IN0-3                                                                */
+/* Break-before-make dead time                                          */
+/************************************************************************/
+ISR(TCD0_OVF_vect)
+{
+   app_complete_break_before_make();
+}
+
+/************************************************************************/ 
+/* DO0 switch marker                                                    */
+/************************************************************************/
+ISR(TCC0_CCA_vect)
+{
+   app_sync_service();
+}
+
+ISR(TCC0_OVF_vect)
+{
+   app_sync_code_service();
+}
+
+/************************************************************************/ 
+/* Channel sequence table and sweep                                     */
 /************************************************************************/
-ISR(PORTB_INT0_vect, ISR_NAKED)
+ISR(TCD1_OVF_vect)
 {
-   if (app_regs.REG_SOURCE == GM_USB)
-   {
-      uint8_t reg_di_state = app_regs.REG_DI_STATE;
-      
-      app_read_REG_DI_STATE();
-      
-      if (app_regs.REG_EVNT_ENABLE & B_EVT_DI_STATE)
-      {
-         if (reg_di_state != app_regs.REG_DI_STATE)
-         {
-            core_func_send_event(ADD_REG_DI_STATE, true);
-         }
-      }
-   }
+   if (app_sweep_is_running())
+      app_sweep_service();
    else
-   {
-      update_outputs(true, false);
-   }
-   
-	reti();
+      app_sequence_service();
+}
+
+/************************************************************************/ 
+/* Input deglitch                                                       */
+/************************************************************************/
+ISR(TCE0_CCA_vect)
+{
+   app_deglitch_service();
+}
+
+/************************************************************************/ 
+/* Switching inputs                                                     */
+/************************************************************************/
+/* All the inputs share a single sampler, a C function, so these ISRs   */
+/* are not naked and the compiler saves the registers and SREG.         */
+/*                                                                      */
+/* Latency budget from an input edge to the EN pins, at 32 MHz          */
+/* (31.25 ns per cycle, hand-counted from the source, measured by       */
+/* REG_LATENCY_EXTERNAL):                                               */
+/*   Pin synchronizer and interrupt response             ~10 cycles     */
+/*   ISR prologue                                        ~30 cycles     */
+/*   TCE0 count and Harp timestamp of the edge           ~70 cycles     */
+/*   Sample and latency start                            ~30 cycles     */
+/*   Decode and commit up to the port stores             ~60 cycles     */
+/*   Fixed part                                         ~200 cycles     */
+/*                                                            (~6.3 us) */
+/* The edge log, the counters, DO0 and the events run after the port    */
+/* stores. REG_DEGLITCH_TIME adds the settle time, then the commit runs */
+/* from the TCE0 compare with about the same fixed part. Channels that  */
+/* are turned on by break-before-make wait REG_SWITCH_DEAD_TIME more.   */
+/*                                                                      */
+/* Every level is delayed by the longest critical section:              */
+/*   Flush of the coalesced events at the end of a window  ~8 us        */
+/*   Deglitch scheduling, up to 6 pending inputs           ~5 us        */
+/*   Break-before-make commit, REG_SNAPSHOT read           ~2.5 us      */
+/*   Others (event drain swap, presets, host mask, ...)    <1.5 us      */
+/* And by one ISR of the same level that is already running. The        */
+/* dead time, the sequence, the sweep and the deglitch share the level  */
+/* of the inputs and each runs a whole switch, ~15 us with its events.  */
+/*                                                                      */
+/* On top of that, depending on REG_INPUTS_PRIORITY:                    */
+/*   High   - At most one HIGH level ISR that is already running        */
+/*            (core UART RX/TX/CTS), since it cannot be preempted.      */
+/*   Medium - Every HIGH level ISR that fires before the port stores.   */
+/*            Grows with the host traffic burst, a host write that      */
+/*            switches the outputs runs a whole switch at HIGH level.   */
+/*   Low    - Every HIGH and MEDIUM level ISR (DO0 pulse and code,      */
+/*            core timers) plus one other LOW level ISR due to the      */
+/*            round-robin scheduling.                                   */
+
+/************************************************************************/ 
+/* IN0-3                                                                */
+/************************************************************************/
+ISR(PORTB_INT0_vect)
+{
+   app_sample_inputs();
 }
 
 /************************************************************************/ 
 /* IN4                                                                  */
 /************************************************************************/
-ISR(PORTC_INT0_vect, ISR_NAKED)
+ISR(PORTC_INT0_vect)
 {
-   if (app_regs.REG_DI4_CONF == GM_DI4_DIGITAL)
-   {
-      uint8_t reg_di_state = app_regs.REG_DI_STATE;
-      
-      app_read_REG_DI_STATE();
-      
-      if (app_regs.REG_EVNT_ENABLE & B_EVT_DI_STATE)
-      {
-         if (reg_di_state != app_regs.REG_DI_STATE)
-         {
-            core_func_send_event(ADD_REG_DI_STATE, true);
-         }
-      }         
-   }
-   else
-   {
-      update_outputs(true, true);
-   }
-      
-	reti();
+   app_sample_inputs();
 }
 
 /************************************************************************/ 
 /* ADD                                                                  */
 /************************************************************************/
-ISR(PORTC_INT1_vect, ISR_NAKED)
+ISR(PORTC_INT1_vect)
 {
-   update_outputs(true, true);
-   
-	reti();
+   app_sample_inputs();
 }
 
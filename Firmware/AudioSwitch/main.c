@@ -1,7 +1,11 @@
 #include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
 
 #include "app.h"
 #include "app_ios_and_regs.h"
+#include "app_events.h"
+#include "app_funcs.h"
 
 int main(void)
 {
@@ -11,7 +15,27 @@ int main(void)
 	/* Enable interrupts */
 	hwbp_app_enable_interrupts;
 	
+	/* Sleep in IDLE mode between interrupts, peripherals keep running */
+	SLEEP_CTRL = SLEEP_SMODE_IDLE_gc | SLEEP_SEN_bm;
+	
 	/* Infinite loop */
-	while(1);
-		//__asm volatile("sleep");
+	while(1)
+	{
+		/* Send the events queued by the interrupts */
+		app_events_drain();
+		
+		/* Recompute REG_CONFIG_CRC after a configuration write */
+		app_update_config_crc();
+		
+		/* The instruction after sei is always executed, so an event    */
+		/* queued after this test wakes the CPU instead of being missed */
+		cli();
+		if (app_events_pending() || app_config_crc_stale())
+		{
+			sei();
+			continue;
+		}
+		sei();
+		sleep_cpu();
+	}
 }
\ No newline at end of file
@@ -44,7 +44,48 @@ namespace Harp.AudioSwitch
             { 36, typeof(Reserved0) },
             { 37, typeof(DI4Trigger) },
             { 38, typeof(DO0Sync) },
-            { 39, typeof(EnableEvents) }
+            { 39, typeof(EnableEvents) },
+            { 40, typeof(SwitchPolicy) },
+            { 41, typeof(SwitchDeadTime) },
+            { 42, typeof(InputsPriority) },
+            { 43, typeof(EventQueueOverflows) },
+            { 44, typeof(EventCoalesceWindow) },
+            { 45, typeof(EventCoalescedEdges) },
+            { 46, typeof(IoState) },
+            { 47, typeof(SequenceAppend) },
+            { 48, typeof(SequenceControl) },
+            { 49, typeof(SequenceStatus) },
+            { 50, typeof(SequenceUnderruns) },
+            { 51, typeof(ArmedChannels) },
+            { 52, typeof(ArmTrigger) },
+            { 53, typeof(EnableChannelsSet) },
+            { 54, typeof(EnableChannelsClear) },
+            { 55, typeof(EnableChannelsToggle) },
+            { 56, typeof(Presets) },
+            { 57, typeof(GateInputs) },
+            { 58, typeof(SweepChannels) },
+            { 59, typeof(SweepDwell) },
+            { 60, typeof(SweepOrder) },
+            { 61, typeof(SweepSeed) },
+            { 62, typeof(SweepRepeats) },
+            { 63, typeof(SweepControl) },
+            { 64, typeof(DO0PulseWidth) },
+            { 65, typeof(DO0CodeUnit) },
+            { 66, typeof(DeglitchTime) },
+            { 67, typeof(DeglitchRejects) },
+            { 68, typeof(StreamKeepAlive) },
+            { 69, typeof(EdgeHistory) },
+            { 70, typeof(EdgeHead) },
+            { 71, typeof(EdgeTail) },
+            { 72, typeof(LatencyExternal) },
+            { 73, typeof(LatencyUsb) },
+            { 74, typeof(LatencyClear) },
+            { 75, typeof(ChannelActivations) },
+            { 76, typeof(ChannelOnTime) },
+            { 77, typeof(EventsSuppressed) },
+            { 78, typeof(SilentSwitches) },
+            { 79, typeof(Snapshot) },
+            { 80, typeof(ConfigCrc) }
         };
 
         /// <summary>
@@ -115,6 +156,47 @@ namespace Harp.AudioSwitch
     /// <seealso cref="DI4Trigger"/>
     /// <seealso cref="DO0Sync"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="SwitchPolicy"/>
+    /// <seealso cref="SwitchDeadTime"/>
+    /// <seealso cref="InputsPriority"/>
+    /// <seealso cref="EventQueueOverflows"/>
+    /// <seealso cref="EventCoalesceWindow"/>
+    /// <seealso cref="EventCoalescedEdges"/>
+    /// <seealso cref="IoState"/>
+    /// <seealso cref="SequenceAppend"/>
+    /// <seealso cref="SequenceControl"/>
+    /// <seealso cref="SequenceStatus"/>
+    /// <seealso cref="SequenceUnderruns"/>
+    /// <seealso cref="ArmedChannels"/>
+    /// <seealso cref="ArmTrigger"/>
+    /// <seealso cref="EnableChannelsSet"/>
+    /// <seealso cref="EnableChannelsClear"/>
+    /// <seealso cref="EnableChannelsToggle"/>
+    /// <seealso cref="Presets"/>
+    /// <seealso cref="GateInputs"/>
+    /// <seealso cref="SweepChannels"/>
+    /// <seealso cref="SweepDwell"/>
+    /// <seealso cref="SweepOrder"/>
+    /// <seealso cref="SweepSeed"/>
+    /// <seealso cref="SweepRepeats"/>
+    /// <seealso cref="SweepControl"/>
+    /// <seealso cref="DO0PulseWidth"/>
+    /// <seealso cref="DO0CodeUnit"/>
+    /// <seealso cref="DeglitchTime"/>
+    /// <seealso cref="DeglitchRejects"/>
+    /// <seealso cref="StreamKeepAlive"/>
+    /// <seealso cref="EdgeHistory"/>
+    /// <seealso cref="EdgeHead"/>
+    /// <seealso cref="EdgeTail"/>
+    /// <seealso cref="LatencyExternal"/>
+    /// <seealso cref="LatencyUsb"/>
+    /// <seealso cref="LatencyClear"/>
+    /// <seealso cref="ChannelActivations"/>
+    /// <seealso cref="ChannelOnTime"/>
+    /// <seealso cref="EventsSuppressed"/>
+    /// <seealso cref="SilentSwitches"/>
+    /// <seealso cref="Snapshot"/>
+    /// <seealso cref="ConfigCrc"/>
     [XmlInclude(typeof(ControlMode))]
     [XmlInclude(typeof(EnableChannels))]
     [XmlInclude(typeof(DigitalInputState))]
@@ -122,6 +204,47 @@ namespace Harp.AudioSwitch
     [XmlInclude(typeof(DI4Trigger))]
     [XmlInclude(typeof(DO0Sync))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(SwitchPolicy))]
+    [XmlInclude(typeof(SwitchDeadTime))]
+    [XmlInclude(typeof(InputsPriority))]
+    [XmlInclude(typeof(EventQueueOverflows))]
+    [XmlInclude(typeof(EventCoalesceWindow))]
+    [XmlInclude(typeof(EventCoalescedEdges))]
+    [XmlInclude(typeof(IoState))]
+    [XmlInclude(typeof(SequenceAppend))]
+    [XmlInclude(typeof(SequenceControl))]
+    [XmlInclude(typeof(SequenceStatus))]
+    [XmlInclude(typeof(SequenceUnderruns))]
+    [XmlInclude(typeof(ArmedChannels))]
+    [XmlInclude(typeof(ArmTrigger))]
+    [XmlInclude(typeof(EnableChannelsSet))]
+    [XmlInclude(typeof(EnableChannelsClear))]
+    [XmlInclude(typeof(EnableChannelsToggle))]
+    [XmlInclude(typeof(Presets))]
+    [XmlInclude(typeof(GateInputs))]
+    [XmlInclude(typeof(SweepChannels))]
+    [XmlInclude(typeof(SweepDwell))]
+    [XmlInclude(typeof(SweepOrder))]
+    [XmlInclude(typeof(SweepSeed))]
+    [XmlInclude(typeof(SweepRepeats))]
+    [XmlInclude(typeof(SweepControl))]
+    [XmlInclude(typeof(DO0PulseWidth))]
+    [XmlInclude(typeof(DO0CodeUnit))]
+    [XmlInclude(typeof(DeglitchTime))]
+    [XmlInclude(typeof(DeglitchRejects))]
+    [XmlInclude(typeof(StreamKeepAlive))]
+    [XmlInclude(typeof(EdgeHistory))]
+    [XmlInclude(typeof(EdgeHead))]
+    [XmlInclude(typeof(EdgeTail))]
+    [XmlInclude(typeof(LatencyExternal))]
+    [XmlInclude(typeof(LatencyUsb))]
+    [XmlInclude(typeof(LatencyClear))]
+    [XmlInclude(typeof(ChannelActivations))]
+    [XmlInclude(typeof(ChannelOnTime))]
+    [XmlInclude(typeof(EventsSuppressed))]
+    [XmlInclude(typeof(SilentSwitches))]
+    [XmlInclude(typeof(Snapshot))]
+    [XmlInclude(typeof(ConfigCrc))]
     [Description("Filters register-specific messages reported by the AudioSwitch device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -150,6 +273,47 @@ namespace Harp.AudioSwitch
     /// <seealso cref="DI4Trigger"/>
     /// <seealso cref="DO0Sync"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="SwitchPolicy"/>
+    /// <seealso cref="SwitchDeadTime"/>
+    /// <seealso cref="InputsPriority"/>
+    /// <seealso cref="EventQueueOverflows"/>
+    /// <seealso cref="EventCoalesceWindow"/>
+    /// <seealso cref="EventCoalescedEdges"/>
+    /// <seealso cref="IoState"/>
+    /// <seealso cref="SequenceAppend"/>
+    /// <seealso cref="SequenceControl"/>
+    /// <seealso cref="SequenceStatus"/>
+    /// <seealso cref="SequenceUnderruns"/>
+    /// <seealso cref="ArmedChannels"/>
+    /// <seealso cref="ArmTrigger"/>
+    /// <seealso cref="EnableChannelsSet"/>
+    /// <seealso cref="EnableChannelsClear"/>
+    /// <seealso cref="EnableChannelsToggle"/>
+    /// <seealso cref="Presets"/>
+    /// <seealso cref="GateInputs"/>
+    /// <seealso cref="SweepChannels"/>
+    /// <seealso cref="SweepDwell"/>
+    /// <seealso cref="SweepOrder"/>
+    /// <seealso cref="SweepSeed"/>
+    /// <seealso cref="SweepRepeats"/>
+    /// <seealso cref="SweepControl"/>
+    /// <seealso cref="DO0PulseWidth"/>
+    /// <seealso cref="DO0CodeUnit"/>
+    /// <seealso cref="DeglitchTime"/>
+    /// <seealso cref="DeglitchRejects"/>
+    /// <seealso cref="StreamKeepAlive"/>
+    /// <seealso cref="EdgeHistory"/>
+    /// <seealso cref="EdgeHead"/>
+    /// <seealso cref="EdgeTail"/>
+    /// <seealso cref="LatencyExternal"/>
+    /// <seealso cref="LatencyUsb"/>
+    /// <seealso cref="LatencyClear"/>
+    /// <seealso cref="ChannelActivations"/>
+    /// <seealso cref="ChannelOnTime"/>
+    /// <seealso cref="EventsSuppressed"/>
+    /// <seealso cref="SilentSwitches"/>
+    /// <seealso cref="Snapshot"/>
+    /// <seealso cref="ConfigCrc"/>
     [XmlInclude(typeof(ControlMode))]
     [XmlInclude(typeof(EnableChannels))]
     [XmlInclude(typeof(DigitalInputState))]
@@ -157,6 +321,47 @@ namespace Harp.AudioSwitch
     [XmlInclude(typeof(DI4Trigger))]
     [XmlInclude(typeof(DO0Sync))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(SwitchPolicy))]
+    [XmlInclude(typeof(SwitchDeadTime))]
+    [XmlInclude(typeof(InputsPriority))]
+    [XmlInclude(typeof(EventQueueOverflows))]
+    [XmlInclude(typeof(EventCoalesceWindow))]
+    [XmlInclude(typeof(EventCoalescedEdges))]
+    [XmlInclude(typeof(IoState))]
+    [XmlInclude(typeof(SequenceAppend))]
+    [XmlInclude(typeof(SequenceControl))]
+    [XmlInclude(typeof(SequenceStatus))]
+    [XmlInclude(typeof(SequenceUnderruns))]
+    [XmlInclude(typeof(ArmedChannels))]
+    [XmlInclude(typeof(ArmTrigger))]
+    [XmlInclude(typeof(EnableChannelsSet))]
+    [XmlInclude(typeof(EnableChannelsClear))]
+    [XmlInclude(typeof(EnableChannelsToggle))]
+    [XmlInclude(typeof(Presets))]
+    [XmlInclude(typeof(GateInputs))]
+    [XmlInclude(typeof(SweepChannels))]
+    [XmlInclude(typeof(SweepDwell))]
+    [XmlInclude(typeof(SweepOrder))]
+    [XmlInclude(typeof(SweepSeed))]
+    [XmlInclude(typeof(SweepRepeats))]
+    [XmlInclude(typeof(SweepControl))]
+    [XmlInclude(typeof(DO0PulseWidth))]
+    [XmlInclude(typeof(DO0CodeUnit))]
+    [XmlInclude(typeof(DeglitchTime))]
+    [XmlInclude(typeof(DeglitchRejects))]
+    [XmlInclude(typeof(StreamKeepAlive))]
+    [XmlInclude(typeof(EdgeHistory))]
+    [XmlInclude(typeof(EdgeHead))]
+    [XmlInclude(typeof(EdgeTail))]
+    [XmlInclude(typeof(LatencyExternal))]
+    [XmlInclude(typeof(LatencyUsb))]
+    [XmlInclude(typeof(LatencyClear))]
+    [XmlInclude(typeof(ChannelActivations))]
+    [XmlInclude(typeof(ChannelOnTime))]
+    [XmlInclude(typeof(EventsSuppressed))]
+    [XmlInclude(typeof(SilentSwitches))]
+    [XmlInclude(typeof(Snapshot))]
+    [XmlInclude(typeof(ConfigCrc))]
     [XmlInclude(typeof(TimestampedControlMode))]
     [XmlInclude(typeof(TimestampedEnableChannels))]
     [XmlInclude(typeof(TimestampedDigitalInputState))]
@@ -164,6 +369,47 @@ namespace Harp.AudioSwitch
     [XmlInclude(typeof(TimestampedDI4Trigger))]
     [XmlInclude(typeof(TimestampedDO0Sync))]
     [XmlInclude(typeof(TimestampedEnableEvents))]
+    [XmlInclude(typeof(TimestampedSwitchPolicy))]
+    [XmlInclude(typeof(TimestampedSwitchDeadTime))]
+    [XmlInclude(typeof(TimestampedInputsPriority))]
+    [XmlInclude(typeof(TimestampedEventQueueOverflows))]
+    [XmlInclude(typeof(TimestampedEventCoalesceWindow))]
+    [XmlInclude(typeof(TimestampedEventCoalescedEdges))]
+    [XmlInclude(typeof(TimestampedIoState))]
+    [XmlInclude(typeof(TimestampedSequenceAppend))]
+    [XmlInclude(typeof(TimestampedSequenceControl))]
+    [XmlInclude(typeof(TimestampedSequenceStatus))]
+    [XmlInclude(typeof(TimestampedSequenceUnderruns))]
+    [XmlInclude(typeof(TimestampedArmedChannels))]
+    [XmlInclude(typeof(TimestampedArmTrigger))]
+    [XmlInclude(typeof(TimestampedEnableChannelsSet))]
+    [XmlInclude(typeof(TimestampedEnableChannelsClear))]
+    [XmlInclude(typeof(TimestampedEnableChannelsToggle))]
+    [XmlInclude(typeof(TimestampedPresets))]
+    [XmlInclude(typeof(TimestampedGateInputs))]
+    [XmlInclude(typeof(TimestampedSweepChannels))]
+    [XmlInclude(typeof(TimestampedSweepDwell))]
+    [XmlInclude(typeof(TimestampedSweepOrder))]
+    [XmlInclude(typeof(TimestampedSweepSeed))]
+    [XmlInclude(typeof(TimestampedSweepRepeats))]
+    [XmlInclude(typeof(TimestampedSweepControl))]
+    [XmlInclude(typeof(TimestampedDO0PulseWidth))]
+    [XmlInclude(typeof(TimestampedDO0CodeUnit))]
+    [XmlInclude(typeof(TimestampedDeglitchTime))]
+    [XmlInclude(typeof(TimestampedDeglitchRejects))]
+    [XmlInclude(typeof(TimestampedStreamKeepAlive))]
+    [XmlInclude(typeof(TimestampedEdgeHistory))]
+    [XmlInclude(typeof(TimestampedEdgeHead))]
+    [XmlInclude(typeof(TimestampedEdgeTail))]
+    [XmlInclude(typeof(TimestampedLatencyExternal))]
+    [XmlInclude(typeof(TimestampedLatencyUsb))]
+    [XmlInclude(typeof(TimestampedLatencyClear))]
+    [XmlInclude(typeof(TimestampedChannelActivations))]
+    [XmlInclude(typeof(TimestampedChannelOnTime))]
+    [XmlInclude(typeof(TimestampedEventsSuppressed))]
+    [XmlInclude(typeof(TimestampedSilentSwitches))]
+    [XmlInclude(typeof(TimestampedSnapshot))]
+    [XmlInclude(typeof(TimestampedConfigCrc))]
     [Description("Filters and selects specific messages reported by the AudioSwitch device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -189,6 +435,47 @@ namespace Harp.AudioSwitch
     /// <seealso cref="DI4Trigger"/>
     /// <seealso cref="DO0Sync"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="SwitchPolicy"/>
+    /// <seealso cref="SwitchDeadTime"/>
+    /// <seealso cref="InputsPriority"/>
+    /// <seealso cref="EventQueueOverflows"/>
+    /// <seealso cref="EventCoalesceWindow"/>
+    /// <seealso cref="EventCoalescedEdges"/>
+    /// <seealso cref="IoState"/>
+    /// <seealso cref="SequenceAppend"/>
+    /// <seealso cref="SequenceControl"/>
+    /// <seealso cref="SequenceStatus"/>
+    /// <seealso cref="SequenceUnderruns"/>
+    /// <seealso cref="ArmedChannels"/>
+    /// <seealso cref="ArmTrigger"/>
+    /// <seealso cref="EnableChannelsSet"/>
+    /// <seealso cref="EnableChannelsClear"/>
+    /// <seealso cref="EnableChannelsToggle"/>
+    /// <seealso cref="Presets"/>
+    /// <seealso cref="GateInputs"/>
+    /// <seealso cref="SweepChannels"/>
+    /// <seealso cref="SweepDwell"/>
+    /// <seealso cref="SweepOrder"/>
+    /// <seealso cref="SweepSeed"/>
+    /// <seealso cref="SweepRepeats"/>
+    /// <seealso cref="SweepControl"/>
+    /// <seealso cref="DO0PulseWidth"/>
+    /// <seealso cref="DO0CodeUnit"/>
+    /// <seealso cref="DeglitchTime"/>
+    /// <seealso cref="DeglitchRejects"/>
+    /// <seealso cref="StreamKeepAlive"/>
+    /// <seealso cref="EdgeHistory"/>
+    /// <seealso cref="EdgeHead"/>
+    /// <seealso cref="EdgeTail"/>
+    /// <seealso cref="LatencyExternal"/>
+    /// <seealso cref="LatencyUsb"/>
+    /// <seealso cref="LatencyClear"/>
+    /// <seealso cref="ChannelActivations"/>
+    /// <seealso cref="ChannelOnTime"/>
+    /// <seealso cref="EventsSuppressed"/>
+    /// <seealso cref="SilentSwitches"/>
+    /// <seealso cref="Snapshot"/>
+    /// <seealso cref="ConfigCrc"/>
     [XmlInclude(typeof(ControlMode))]
     [XmlInclude(typeof(EnableChannels))]
     [XmlInclude(typeof(DigitalInputState))]
@@ -196,6 +483,47 @@ namespace Harp.AudioSwitch
     [XmlInclude(typeof(DI4Trigger))]
     [XmlInclude(typeof(DO0Sync))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(SwitchPolicy))]
+    [XmlInclude(typeof(SwitchDeadTime))]
+    [XmlInclude(typeof(InputsPriority))]
+    [XmlInclude(typeof(EventQueueOverflows))]
+    [XmlInclude(typeof(EventCoalesceWindow))]
+    [XmlInclude(typeof(EventCoalescedEdges))]
+    [XmlInclude(typeof(IoState))]
+    [XmlInclude(typeof(SequenceAppend))]
+    [XmlInclude(typeof(SequenceControl))]
+    [XmlInclude(typeof(SequenceStatus))]
+    [XmlInclude(typeof(SequenceUnderruns))]
+    [XmlInclude(typeof(ArmedChannels))]
+    [XmlInclude(typeof(ArmTrigger))]
+    [XmlInclude(typeof(EnableChannelsSet))]
+    [XmlInclude(typeof(EnableChannelsClear))]
+    [XmlInclude(typeof(EnableChannelsToggle))]
+    [XmlInclude(typeof(Presets))]
+    [XmlInclude(typeof(GateInputs))]
+    [XmlInclude(typeof(SweepChannels))]
+    [XmlInclude(typeof(SweepDwell))]
+    [XmlInclude(typeof(SweepOrder))]
+    [XmlInclude(typeof(SweepSeed))]
+    [XmlInclude(typeof(SweepRepeats))]
+    [XmlInclude(typeof(SweepControl))]
+    [XmlInclude(typeof(DO0PulseWidth))]
+    [XmlInclude(typeof(DO0CodeUnit))]
+    [XmlInclude(typeof(DeglitchTime))]
+    [XmlInclude(typeof(DeglitchRejects))]
+    [XmlInclude(typeof(StreamKeepAlive))]
+    [XmlInclude(typeof(EdgeHistory))]
+    [XmlInclude(typeof(EdgeHead))]
+    [XmlInclude(typeof(EdgeTail))]
+    [XmlInclude(typeof(LatencyExternal))]
+    [XmlInclude(typeof(LatencyUsb))]
+    [XmlInclude(typeof(LatencyClear))]
+    [XmlInclude(typeof(ChannelActivations))]
+    [XmlInclude(typeof(ChannelOnTime))]
+    [XmlInclude(typeof(EventsSuppressed))]
+    [XmlInclude(typeof(SilentSwitches))]
+    [XmlInclude(typeof(Snapshot))]
+    [XmlInclude(typeof(ConfigCrc))]
     [Description("Formats a sequence of values as specific AudioSwitch register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -911,420 +1239,6705 @@ namespace Harp.AudioSwitch
         }
     }
 
+    /// <summary>
+    /// Represents a register that configures how a new channel mask is committed to the audio output channels.
+    /// </summary>
+    [Description("Configures how a new channel mask is committed to the audio output channels.")]
+    public partial class SwitchPolicy
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SwitchPolicy"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 40;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SwitchPolicy"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SwitchPolicy"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SwitchPolicy"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static SwitchPolicyConfig GetPayload(HarpMessage message)
+        {
+            return (SwitchPolicyConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SwitchPolicy"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SwitchPolicyConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((SwitchPolicyConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SwitchPolicy"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SwitchPolicy"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, SwitchPolicyConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SwitchPolicy"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SwitchPolicy"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, SwitchPolicyConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SwitchPolicy register.
+    /// </summary>
+    /// <seealso cref="SwitchPolicy"/>
+    [Description("Filters and selects timestamped messages from the SwitchPolicy register.")]
+    public partial class TimestampedSwitchPolicy
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SwitchPolicy"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SwitchPolicy.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SwitchPolicy"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SwitchPolicyConfig> GetPayload(HarpMessage message)
+        {
+            return SwitchPolicy.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that dead time, in microseconds, between disabling and enabling channels when using the break-before-make policy.
+    /// </summary>
+    [Description("Dead time, in microseconds, between disabling and enabling channels when using the break-before-make policy.")]
+    public partial class SwitchDeadTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SwitchDeadTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 41;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SwitchDeadTime"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SwitchDeadTime"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SwitchDeadTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SwitchDeadTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SwitchDeadTime"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SwitchDeadTime"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SwitchDeadTime"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SwitchDeadTime"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SwitchDeadTime register.
+    /// </summary>
+    /// <seealso cref="SwitchDeadTime"/>
+    [Description("Filters and selects timestamped messages from the SwitchDeadTime register.")]
+    public partial class TimestampedSwitchDeadTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SwitchDeadTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SwitchDeadTime.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SwitchDeadTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return SwitchDeadTime.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the interrupt priority of the digital inputs used to switch the audio output channels.
+    /// </summary>
+    [Description("Configures the interrupt priority of the digital inputs used to switch the audio output channels.")]
+    public partial class InputsPriority
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="InputsPriority"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 42;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="InputsPriority"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="InputsPriority"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="InputsPriority"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static InputsPriorityConfig GetPayload(HarpMessage message)
+        {
+            return (InputsPriorityConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="InputsPriority"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<InputsPriorityConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((InputsPriorityConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="InputsPriority"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="InputsPriority"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, InputsPriorityConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="InputsPriority"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="InputsPriority"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, InputsPriorityConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// InputsPriority register.
+    /// </summary>
+    /// <seealso cref="InputsPriority"/>
+    [Description("Filters and selects timestamped messages from the InputsPriority register.")]
+    public partial class TimestampedInputsPriority
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="InputsPriority"/> register. This field is constant.
+        /// </summary>
+        public const int Address = InputsPriority.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="InputsPriority"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<InputsPriorityConfig> GetPayload(HarpMessage message)
+        {
+            return InputsPriority.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of events lost because the firmware event queue was full.
+    /// </summary>
+    [Description("Number of events lost because the firmware event queue was full.")]
+    public partial class EventQueueOverflows
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventQueueOverflows"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 43;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EventQueueOverflows"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EventQueueOverflows"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EventQueueOverflows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EventQueueOverflows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EventQueueOverflows"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventQueueOverflows"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EventQueueOverflows"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventQueueOverflows"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EventQueueOverflows register.
+    /// </summary>
+    /// <seealso cref="EventQueueOverflows"/>
+    [Description("Filters and selects timestamped messages from the EventQueueOverflows register.")]
+    public partial class TimestampedEventQueueOverflows
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventQueueOverflows"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EventQueueOverflows.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EventQueueOverflows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return EventQueueOverflows.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that window, in milliseconds, used to coalesce the EnableChannels, DigitalInputState and IoState events. Ignored in Speed Mode, where every IoState event is sent. At most one event per register is sent per window, carrying the latest state. A value of 0 sends every event.
+    /// </summary>
+    [Description("Window, in milliseconds, used to coalesce the EnableChannels, DigitalInputState and IoState events. Ignored in Speed Mode, where every IoState event is sent. At most one event per register is sent per window, carrying the latest state. A value of 0 sends every event.")]
+    public partial class EventCoalesceWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventCoalesceWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 44;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EventCoalesceWindow"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EventCoalesceWindow"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EventCoalesceWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EventCoalesceWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EventCoalesceWindow"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventCoalesceWindow"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EventCoalesceWindow"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventCoalesceWindow"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EventCoalesceWindow register.
+    /// </summary>
+    /// <seealso cref="EventCoalesceWindow"/>
+    [Description("Filters and selects timestamped messages from the EventCoalesceWindow register.")]
+    public partial class TimestampedEventCoalesceWindow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventCoalesceWindow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EventCoalesceWindow.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EventCoalesceWindow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return EventCoalesceWindow.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of edges folded into the last coalesced EnableChannels, DigitalInputState and IoState events, in this order. Sent at the end of each window where edges were folded, when enabled in EnableEvents.
+    /// </summary>
+    [Description("Number of edges folded into the last coalesced EnableChannels, DigitalInputState and IoState events, in this order. Sent at the end of each window where edges were folded, when enabled in EnableEvents.")]
+    public partial class EventCoalescedEdges
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventCoalescedEdges"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 45;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EventCoalescedEdges"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EventCoalescedEdges"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 3;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EventCoalescedEdges"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EventCoalescedEdges"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EventCoalescedEdges"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventCoalescedEdges"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EventCoalescedEdges"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventCoalescedEdges"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EventCoalescedEdges register.
+    /// </summary>
+    /// <seealso cref="EventCoalescedEdges"/>
+    [Description("Filters and selects timestamped messages from the EventCoalescedEdges register.")]
+    public partial class TimestampedEventCoalescedEdges
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventCoalescedEdges"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EventCoalescedEdges.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EventCoalescedEdges"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return EventCoalescedEdges.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that combined state of the board. Bits 0 to 15 are the enabled channels, bits 16 to 20 the digital inputs and bit 24 the state of DO0. Sent instead of the EnableChannels and DigitalInputState events when the IoState event is enabled.
+    /// </summary>
+    [Description("Combined state of the board. Bits 0 to 15 are the enabled channels, bits 16 to 20 the digital inputs and bit 24 the state of DO0. Sent instead of the EnableChannels and DigitalInputState events when the IoState event is enabled.")]
+    public partial class IoState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IoState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 46;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="IoState"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="IoState"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="IoState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="IoState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="IoState"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IoState"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="IoState"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IoState"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// IoState register.
+    /// </summary>
+    /// <seealso cref="IoState"/>
+    [Description("Filters and selects timestamped messages from the IoState register.")]
+    public partial class TimestampedIoState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IoState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = IoState.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="IoState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return IoState.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that appends an entry to the channel sequence table. Elements 0 and 1 are the low and high words of the Harp timestamp seconds, element 2 the Harp timestamp microseconds in units of 32 us, and element 3 the channel mask applied at that time.
+    /// </summary>
+    [Description("Appends an entry to the channel sequence table. Elements 0 and 1 are the low and high words of the Harp timestamp seconds, element 2 the Harp timestamp microseconds in units of 32 us, and element 3 the channel mask applied at that time.")]
+    public partial class SequenceAppend
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceAppend"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 47;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceAppend"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceAppend"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceAppend"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceAppend"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceAppend"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceAppend"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceAppend"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceAppend"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceAppend register.
+    /// </summary>
+    /// <seealso cref="SequenceAppend"/>
+    [Description("Filters and selects timestamped messages from the SequenceAppend register.")]
+    public partial class TimestampedSequenceAppend
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceAppend"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceAppend.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceAppend"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return SequenceAppend.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts, stops or clears the channel sequence table. The sequence can only be started when the board is controlled by USB.
+    /// </summary>
+    [Description("Starts, stops or clears the channel sequence table. The sequence can only be started when the board is controlled by USB.")]
+    public partial class SequenceControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 48;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceControl"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceControl"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static SequenceControlConfig GetPayload(HarpMessage message)
+        {
+            return (SequenceControlConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SequenceControlConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((SequenceControlConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceControl"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceControl"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, SequenceControlConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceControl"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceControl"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, SequenceControlConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceControl register.
+    /// </summary>
+    /// <seealso cref="SequenceControl"/>
+    [Description("Filters and selects timestamped messages from the SequenceControl register.")]
+    public partial class TimestampedSequenceControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceControl.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SequenceControlConfig> GetPayload(HarpMessage message)
+        {
+            return SequenceControl.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that bits 0 to 5 are the number of entries pending in the sequence table and bit 7 is set while the sequence runs. Sent when the sequence runs out of entries.
+    /// </summary>
+    [Description("Bits 0 to 5 are the number of entries pending in the sequence table and bit 7 is set while the sequence runs. Sent when the sequence runs out of entries.")]
+    public partial class SequenceStatus
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceStatus"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 49;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceStatus"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceStatus"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceStatus"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceStatus"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceStatus"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceStatus"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceStatus"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceStatus"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceStatus register.
+    /// </summary>
+    /// <seealso cref="SequenceStatus"/>
+    [Description("Filters and selects timestamped messages from the SequenceStatus register.")]
+    public partial class TimestampedSequenceStatus
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceStatus"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceStatus.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceStatus"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return SequenceStatus.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of sequence entries applied more than 1 ms after their timestamp.
+    /// </summary>
+    [Description("Number of sequence entries applied more than 1 ms after their timestamp.")]
+    public partial class SequenceUnderruns
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceUnderruns"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 50;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceUnderruns"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceUnderruns"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceUnderruns"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceUnderruns"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceUnderruns"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceUnderruns"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceUnderruns"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceUnderruns"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceUnderruns register.
+    /// </summary>
+    /// <seealso cref="SequenceUnderruns"/>
+    [Description("Filters and selects timestamped messages from the SequenceUnderruns register.")]
+    public partial class TimestampedSequenceUnderruns
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceUnderruns"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceUnderruns.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceUnderruns"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return SequenceUnderruns.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that channel mask applied to the audio output channels on the next trigger edge. Writing it arms the trigger. Only accepted when the board is controlled by USB.
+    /// </summary>
+    [Description("Channel mask applied to the audio output channels on the next trigger edge. Writing it arms the trigger. Only accepted when the board is controlled by USB.")]
+    public partial class ArmedChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ArmedChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 51;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ArmedChannels"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ArmedChannels"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ArmedChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AudioChannels GetPayload(HarpMessage message)
+        {
+            return (AudioChannels)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ArmedChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AudioChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((AudioChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ArmedChannels"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ArmedChannels"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AudioChannels value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ArmedChannels"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ArmedChannels"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AudioChannels value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ArmedChannels register.
+    /// </summary>
+    /// <seealso cref="ArmedChannels"/>
+    [Description("Filters and selects timestamped messages from the ArmedChannels register.")]
+    public partial class TimestampedArmedChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ArmedChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ArmedChannels.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ArmedChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AudioChannels> GetPayload(HarpMessage message)
+        {
+            return ArmedChannels.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that bits 0 to 2 select the digital input (0 to 4) and bits 4 and 5 the edges (1 rising, 2 falling, 3 both) that apply the armed channel mask. Bit 7 is read only and set while the trigger is armed.
+    /// </summary>
+    [Description("Bits 0 to 2 select the digital input (0 to 4) and bits 4 and 5 the edges (1 rising, 2 falling, 3 both) that apply the armed channel mask. Bit 7 is read only and set while the trigger is armed.")]
+    public partial class ArmTrigger
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ArmTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 52;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ArmTrigger"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ArmTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ArmTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ArmTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ArmTrigger"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ArmTrigger"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ArmTrigger"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ArmTrigger"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ArmTrigger register.
+    /// </summary>
+    /// <seealso cref="ArmTrigger"/>
+    [Description("Filters and selects timestamped messages from the ArmTrigger register.")]
+    public partial class TimestampedArmTrigger
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ArmTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ArmTrigger.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ArmTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return ArmTrigger.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that enables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+    /// </summary>
+    [Description("Enables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.")]
+    public partial class EnableChannelsSet
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnableChannelsSet"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 53;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EnableChannelsSet"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EnableChannelsSet"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EnableChannelsSet"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AudioChannels GetPayload(HarpMessage message)
+        {
+            return (AudioChannels)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EnableChannelsSet"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AudioChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((AudioChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EnableChannelsSet"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnableChannelsSet"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AudioChannels value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EnableChannelsSet"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnableChannelsSet"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AudioChannels value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EnableChannelsSet register.
+    /// </summary>
+    /// <seealso cref="EnableChannelsSet"/>
+    [Description("Filters and selects timestamped messages from the EnableChannelsSet register.")]
+    public partial class TimestampedEnableChannelsSet
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnableChannelsSet"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EnableChannelsSet.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EnableChannelsSet"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AudioChannels> GetPayload(HarpMessage message)
+        {
+            return EnableChannelsSet.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that disables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+    /// </summary>
+    [Description("Disables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.")]
+    public partial class EnableChannelsClear
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnableChannelsClear"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 54;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EnableChannelsClear"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EnableChannelsClear"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EnableChannelsClear"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AudioChannels GetPayload(HarpMessage message)
+        {
+            return (AudioChannels)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EnableChannelsClear"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AudioChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((AudioChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EnableChannelsClear"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnableChannelsClear"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AudioChannels value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EnableChannelsClear"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnableChannelsClear"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AudioChannels value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EnableChannelsClear register.
+    /// </summary>
+    /// <seealso cref="EnableChannelsClear"/>
+    [Description("Filters and selects timestamped messages from the EnableChannelsClear register.")]
+    public partial class TimestampedEnableChannelsClear
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnableChannelsClear"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EnableChannelsClear.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EnableChannelsClear"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AudioChannels> GetPayload(HarpMessage message)
+        {
+            return EnableChannelsClear.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that toggles the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+    /// </summary>
+    [Description("Toggles the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.")]
+    public partial class EnableChannelsToggle
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnableChannelsToggle"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 55;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EnableChannelsToggle"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EnableChannelsToggle"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EnableChannelsToggle"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AudioChannels GetPayload(HarpMessage message)
+        {
+            return (AudioChannels)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EnableChannelsToggle"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AudioChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((AudioChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EnableChannelsToggle"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnableChannelsToggle"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AudioChannels value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EnableChannelsToggle"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EnableChannelsToggle"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AudioChannels value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EnableChannelsToggle register.
+    /// </summary>
+    /// <seealso cref="EnableChannelsToggle"/>
+    [Description("Filters and selects timestamped messages from the EnableChannelsToggle register.")]
+    public partial class TimestampedEnableChannelsToggle
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EnableChannelsToggle"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EnableChannelsToggle.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EnableChannelsToggle"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AudioChannels> GetPayload(HarpMessage message)
+        {
+            return EnableChannelsToggle.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that table of channel masks used by the DigitalInputsPresets source. DI0 to DI4 select the preset, or DI0 to DI3 when DI4 is used as address. Kept in EEPROM when the registers are saved.
+    /// </summary>
+    [Description("Table of channel masks used by the DigitalInputsPresets source. DI0 to DI4 select the preset, or DI0 to DI3 when DI4 is used as address. Kept in EEPROM when the registers are saved.")]
+    public partial class Presets
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Presets"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 56;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Presets"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Presets"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 32;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Presets"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Presets"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Presets"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Presets"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Presets"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Presets"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Presets register.
+    /// </summary>
+    /// <seealso cref="Presets"/>
+    [Description("Filters and selects timestamped messages from the Presets register.")]
+    public partial class TimestampedPresets
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Presets"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Presets.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Presets"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return Presets.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that digital inputs that gate the host channel mask in the GatedUSB source. The channels are disabled while any of the selected inputs is low.
+    /// </summary>
+    [Description("Digital inputs that gate the host channel mask in the GatedUSB source. The channels are disabled while any of the selected inputs is low.")]
+    public partial class GateInputs
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="GateInputs"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 57;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="GateInputs"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="GateInputs"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="GateInputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputs GetPayload(HarpMessage message)
+        {
+            return (DigitalInputs)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="GateInputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((DigitalInputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="GateInputs"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="GateInputs"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="GateInputs"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="GateInputs"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// GateInputs register.
+    /// </summary>
+    /// <seealso cref="GateInputs"/>
+    [Description("Filters and selects timestamped messages from the GateInputs register.")]
+    public partial class TimestampedGateInputs
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="GateInputs"/> register. This field is constant.
+        /// </summary>
+        public const int Address = GateInputs.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="GateInputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetPayload(HarpMessage message)
+        {
+            return GateInputs.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that audio output channels enabled one at a time by the sweep.
+    /// </summary>
+    [Description("Audio output channels enabled one at a time by the sweep.")]
+    public partial class SweepChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SweepChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 58;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SweepChannels"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SweepChannels"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SweepChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static AudioChannels GetPayload(HarpMessage message)
+        {
+            return (AudioChannels)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SweepChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AudioChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((AudioChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SweepChannels"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SweepChannels"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, AudioChannels value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SweepChannels"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SweepChannels"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, AudioChannels value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SweepChannels register.
+    /// </summary>
+    /// <seealso cref="SweepChannels"/>
+    [Description("Filters and selects timestamped messages from the SweepChannels register.")]
+    public partial class TimestampedSweepChannels
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SweepChannels"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SweepChannels.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SweepChannels"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<AudioChannels> GetPayload(HarpMessage message)
+        {
+            return SweepChannels.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time, in microseconds, each channel of the sweep is enabled. The minimum is 100 us.
+    /// </summary>
+    [Description("Time, in microseconds, each channel of the sweep is enabled. The minimum is 100 us.")]
+    public partial class SweepDwell
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SweepDwell"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 59;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SweepDwell"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SweepDwell"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SweepDwell"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SweepDwell"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SweepDwell"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SweepDwell"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SweepDwell"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SweepDwell"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SweepDwell register.
+    /// </summary>
+    /// <seealso cref="SweepDwell"/>
+    [Description("Filters and selects timestamped messages from the SweepDwell register.")]
+    public partial class TimestampedSweepDwell
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SweepDwell"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SweepDwell.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SweepDwell"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return SweepDwell.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that order of the channels in each pass of the sweep.
+    /// </summary>
+    [Description("Order of the channels in each pass of the sweep.")]
+    public partial class SweepOrder
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SweepOrder"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 60;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SweepOrder"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SweepOrder"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SweepOrder"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static SweepOrderConfig GetPayload(HarpMessage message)
+        {
+            return (SweepOrderConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SweepOrder"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SweepOrderConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((SweepOrderConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SweepOrder"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SweepOrder"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, SweepOrderConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SweepOrder"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SweepOrder"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, SweepOrderConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SweepOrder register.
+    /// </summary>
+    /// <seealso cref="SweepOrder"/>
+    [Description("Filters and selects timestamped messages from the SweepOrder register.")]
+    public partial class TimestampedSweepOrder
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SweepOrder"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SweepOrder.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SweepOrder"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SweepOrderConfig> GetPayload(HarpMessage message)
+        {
+            return SweepOrder.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that seed of the pseudo-random order of the sweep. The same seed repeats the same order.
+    /// </summary>
+    [Description("Seed of the pseudo-random order of the sweep. The same seed repeats the same order.")]
+    public partial class SweepSeed
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SweepSeed"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 61;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SweepSeed"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SweepSeed"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SweepSeed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SweepSeed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SweepSeed"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SweepSeed"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SweepSeed"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SweepSeed"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SweepSeed register.
+    /// </summary>
+    /// <seealso cref="SweepSeed"/>
+    [Description("Filters and selects timestamped messages from the SweepSeed register.")]
+    public partial class TimestampedSweepSeed
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SweepSeed"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SweepSeed.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SweepSeed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return SweepSeed.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of passes through the sweep channels. A value of 0 sweeps until stopped.
+    /// </summary>
+    [Description("Number of passes through the sweep channels. A value of 0 sweeps until stopped.")]
+    public partial class SweepRepeats
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SweepRepeats"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 62;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SweepRepeats"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SweepRepeats"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SweepRepeats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SweepRepeats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SweepRepeats"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SweepRepeats"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SweepRepeats"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SweepRepeats"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SweepRepeats register.
+    /// </summary>
+    /// <seealso cref="SweepRepeats"/>
+    [Description("Filters and selects timestamped messages from the SweepRepeats register.")]
+    public partial class TimestampedSweepRepeats
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SweepRepeats"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SweepRepeats.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SweepRepeats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return SweepRepeats.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts or stops the sweep. The sweep can only be started when the board is controlled by USB. An event is emitted when the last pass ends and the channels are disabled.
+    /// </summary>
+    [Description("Starts or stops the sweep. The sweep can only be started when the board is controlled by USB. An event is emitted when the last pass ends and the channels are disabled.")]
+    public partial class SweepControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SweepControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 63;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SweepControl"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SweepControl"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SweepControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static SweepControlConfig GetPayload(HarpMessage message)
+        {
+            return (SweepControlConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SweepControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SweepControlConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((SweepControlConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SweepControl"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SweepControl"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, SweepControlConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SweepControl"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SweepControl"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, SweepControlConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SweepControl register.
+    /// </summary>
+    /// <seealso cref="SweepControl"/>
+    [Description("Filters and selects timestamped messages from the SweepControl register.")]
+    public partial class TimestampedSweepControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SweepControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SweepControl.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SweepControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SweepControlConfig> GetPayload(HarpMessage message)
+        {
+            return SweepControl.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that width, in microseconds, of the DO0 pulse emitted on every channel change when DO0 is configured as PulseOnChannelChange. The maximum is 8000 us.
+    /// </summary>
+    [Description("Width, in microseconds, of the DO0 pulse emitted on every channel change when DO0 is configured as PulseOnChannelChange. The maximum is 8000 us.")]
+    public partial class DO0PulseWidth
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0PulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 64;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0PulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0PulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0PulseWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0PulseWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0PulseWidth"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0PulseWidth"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0PulseWidth"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0PulseWidth"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0PulseWidth register.
+    /// </summary>
+    /// <seealso cref="DO0PulseWidth"/>
+    [Description("Filters and selects timestamped messages from the DO0PulseWidth register.")]
+    public partial class TimestampedDO0PulseWidth
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0PulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0PulseWidth.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0PulseWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return DO0PulseWidth.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time unit, in microseconds, of the DO0 code emitted on every channel change when DO0 is configured as CodeOnChannelChange. Every symbol lasts 4 units and is high for 3 units (start), 2 units (bit set) or 1 unit (bit cleared). A start symbol is followed by the 16 bits of the new channel mask, LSB first, and by one idle symbol that keeps DO0 low for 4 units so the next code can be found. Valid from 10 to 4000 us.
+    /// </summary>
+    [Description("Time unit, in microseconds, of the DO0 code emitted on every channel change when DO0 is configured as CodeOnChannelChange. Every symbol lasts 4 units and is high for 3 units (start), 2 units (bit set) or 1 unit (bit cleared). A start symbol is followed by the 16 bits of the new channel mask, LSB first, and by one idle symbol that keeps DO0 low for 4 units so the next code can be found. Valid from 10 to 4000 us.")]
+    public partial class DO0CodeUnit
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0CodeUnit"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 65;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0CodeUnit"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0CodeUnit"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0CodeUnit"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0CodeUnit"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0CodeUnit"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0CodeUnit"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0CodeUnit"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0CodeUnit"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0CodeUnit register.
+    /// </summary>
+    /// <seealso cref="DO0CodeUnit"/>
+    [Description("Filters and selects timestamped messages from the DO0CodeUnit register.")]
+    public partial class TimestampedDO0CodeUnit
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0CodeUnit"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0CodeUnit.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0CodeUnit"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return DO0CodeUnit.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time, in microseconds, each digital input must be stable after its last edge before it switches the channels or generates events. Each input is filtered on its own, so a noisy input does not delay the others. A value of 0 disables the filter. The maximum is 16000 us. Writing it clears the DeglitchRejects counters.
+    /// </summary>
+    [Description("Time, in microseconds, each digital input must be stable after its last edge before it switches the channels or generates events. Each input is filtered on its own, so a noisy input does not delay the others. A value of 0 disables the filter. The maximum is 16000 us. Writing it clears the DeglitchRejects counters.")]
+    public partial class DeglitchTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DeglitchTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 66;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DeglitchTime"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DeglitchTime"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DeglitchTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DeglitchTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DeglitchTime"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DeglitchTime"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DeglitchTime"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DeglitchTime"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DeglitchTime register.
+    /// </summary>
+    /// <seealso cref="DeglitchTime"/>
+    [Description("Filters and selects timestamped messages from the DeglitchTime register.")]
+    public partial class TimestampedDeglitchTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DeglitchTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DeglitchTime.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DeglitchTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return DeglitchTime.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of glitches rejected by the deglitch filter on DI0 to DI4 and ADD, in this order.
+    /// </summary>
+    [Description("Number of glitches rejected by the deglitch filter on DI0 to DI4 and ADD, in this order.")]
+    public partial class DeglitchRejects
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DeglitchRejects"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 67;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DeglitchRejects"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DeglitchRejects"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 6;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DeglitchRejects"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DeglitchRejects"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DeglitchRejects"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DeglitchRejects"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DeglitchRejects"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DeglitchRejects"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DeglitchRejects register.
+    /// </summary>
+    /// <seealso cref="DeglitchRejects"/>
+    [Description("Filters and selects timestamped messages from the DeglitchRejects register.")]
+    public partial class TimestampedDeglitchRejects
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DeglitchRejects"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DeglitchRejects.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DeglitchRejects"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return DeglitchRejects.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that period, in milliseconds, of the IoState keep-alive sent in Speed Mode when nothing changes. In Speed Mode every change of the channels, digital inputs and DO0 is sent as an IoState event, regardless of EnableEvents and EventCoalesceWindow. A value of 0 disables the keep-alive.
+    /// </summary>
+    [Description("Period, in milliseconds, of the IoState keep-alive sent in Speed Mode when nothing changes. In Speed Mode every change of the channels, digital inputs and DO0 is sent as an IoState event, regardless of EnableEvents and EventCoalesceWindow. A value of 0 disables the keep-alive.")]
+    public partial class StreamKeepAlive
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StreamKeepAlive"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 68;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StreamKeepAlive"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StreamKeepAlive"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StreamKeepAlive"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StreamKeepAlive"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StreamKeepAlive"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StreamKeepAlive"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StreamKeepAlive"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StreamKeepAlive"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StreamKeepAlive register.
+    /// </summary>
+    /// <seealso cref="StreamKeepAlive"/>
+    [Description("Filters and selects timestamped messages from the StreamKeepAlive register.")]
+    public partial class TimestampedStreamKeepAlive
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StreamKeepAlive"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StreamKeepAlive.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StreamKeepAlive"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return StreamKeepAlive.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that ring of the last 16 input edges, two words per edge. The first word is the timestamp second. The second word holds the timestamp microseconds, in 32 us units, in bits 0 to 15, and the state of DI0 to DI4 and ADD after the edge in bits 16 to 21. The unread edges go from EdgeTail up to, but excluding, EdgeHead. Read EdgeHead before EdgeHistory, so that only the edges logged before that read are freed.
+    /// </summary>
+    [Description("Ring of the last 16 input edges, two words per edge. The first word is the timestamp second. The second word holds the timestamp microseconds, in 32 us units, in bits 0 to 15, and the state of DI0 to DI4 and ADD after the edge in bits 16 to 21. The unread edges go from EdgeTail up to, but excluding, EdgeHead. Read EdgeHead before EdgeHistory, so that only the edges logged before that read are freed.")]
+    public partial class EdgeHistory
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeHistory"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 69;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EdgeHistory"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EdgeHistory"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 32;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EdgeHistory"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EdgeHistory"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EdgeHistory"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeHistory"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EdgeHistory"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeHistory"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EdgeHistory register.
+    /// </summary>
+    /// <seealso cref="EdgeHistory"/>
+    [Description("Filters and selects timestamped messages from the EdgeHistory register.")]
+    public partial class TimestampedEdgeHistory
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeHistory"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EdgeHistory.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EdgeHistory"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return EdgeHistory.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that bits 0 to 3 are the entry written by the next input edge. Bit 7 is set when edges were dropped because the ring was full, and is cleared by a write to EdgeTail.
+    /// </summary>
+    [Description("Bits 0 to 3 are the entry written by the next input edge. Bit 7 is set when edges were dropped because the ring was full, and is cleared by a write to EdgeTail.")]
+    public partial class EdgeHead
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeHead"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 70;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EdgeHead"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EdgeHead"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EdgeHead"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EdgeHead"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EdgeHead"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeHead"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EdgeHead"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeHead"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EdgeHead register.
+    /// </summary>
+    /// <seealso cref="EdgeHead"/>
+    [Description("Filters and selects timestamped messages from the EdgeHead register.")]
+    public partial class TimestampedEdgeHead
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeHead"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EdgeHead.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EdgeHead"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return EdgeHead.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that first entry of EdgeHistory not read yet (0 to 15). Read EdgeHead first, then EdgeHistory, and write bits 0 to 3 of that EdgeHead value to free the entries read. Edges logged after the read of EdgeHead stay in the ring.
+    /// </summary>
+    [Description("First entry of EdgeHistory not read yet (0 to 15). Read EdgeHead first, then EdgeHistory, and write bits 0 to 3 of that EdgeHead value to free the entries read. Edges logged after the read of EdgeHead stay in the ring.")]
+    public partial class EdgeTail
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeTail"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 71;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EdgeTail"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EdgeTail"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EdgeTail"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EdgeTail"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EdgeTail"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeTail"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EdgeTail"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeTail"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EdgeTail register.
+    /// </summary>
+    /// <seealso cref="EdgeTail"/>
+    [Description("Filters and selects timestamped messages from the EdgeTail register.")]
+    public partial class TimestampedEdgeTail
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeTail"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EdgeTail.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EdgeTail"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return EdgeTail.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that histogram of the time from the digital input interrupt to the write of the audio channels, including the deglitch time. Bin n counts the switches that took from 2^(n-1) to 2^n - 1 ticks of 0.25 us, bin 0 the ones under one tick and bin 15 the ones of 2^14 ticks or more. The counts saturate at 65535.
+    /// </summary>
+    [Description("Histogram of the time from the digital input interrupt to the write of the audio channels, including the deglitch time. Bin n counts the switches that took from 2^(n-1) to 2^n - 1 ticks of 0.25 us, bin 0 the ones under one tick and bin 15 the ones of 2^14 ticks or more. The counts saturate at 65535.")]
+    public partial class LatencyExternal
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyExternal"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 72;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LatencyExternal"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LatencyExternal"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LatencyExternal"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LatencyExternal"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LatencyExternal"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyExternal"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LatencyExternal"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyExternal"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LatencyExternal register.
+    /// </summary>
+    /// <seealso cref="LatencyExternal"/>
+    [Description("Filters and selects timestamped messages from the LatencyExternal register.")]
+    public partial class TimestampedLatencyExternal
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyExternal"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LatencyExternal.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LatencyExternal"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return LatencyExternal.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that histogram of the time from the dispatch of a host write to the write of the audio channels, with the same bins as LatencyExternal.
+    /// </summary>
+    [Description("Histogram of the time from the dispatch of a host write to the write of the audio channels, with the same bins as LatencyExternal.")]
+    public partial class LatencyUsb
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyUsb"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 73;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LatencyUsb"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LatencyUsb"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LatencyUsb"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LatencyUsb"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LatencyUsb"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyUsb"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LatencyUsb"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyUsb"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LatencyUsb register.
+    /// </summary>
+    /// <seealso cref="LatencyUsb"/>
+    [Description("Filters and selects timestamped messages from the LatencyUsb register.")]
+    public partial class TimestampedLatencyUsb
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyUsb"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LatencyUsb.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LatencyUsb"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return LatencyUsb.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that clears the selected latency histograms.
+    /// </summary>
+    [Description("Clears the selected latency histograms.")]
+    public partial class LatencyClear
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyClear"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 74;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LatencyClear"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LatencyClear"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LatencyClear"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static LatencyClearFlags GetPayload(HarpMessage message)
+        {
+            return (LatencyClearFlags)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LatencyClear"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<LatencyClearFlags> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((LatencyClearFlags)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LatencyClear"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyClear"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, LatencyClearFlags value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LatencyClear"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LatencyClear"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, LatencyClearFlags value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LatencyClear register.
+    /// </summary>
+    /// <seealso cref="LatencyClear"/>
+    [Description("Filters and selects timestamped messages from the LatencyClear register.")]
+    public partial class TimestampedLatencyClear
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LatencyClear"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LatencyClear.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LatencyClear"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<LatencyClearFlags> GetPayload(HarpMessage message)
+        {
+            return LatencyClear.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of times each audio channel was enabled since the last reset.
+    /// </summary>
+    [Description("Number of times each audio channel was enabled since the last reset.")]
+    public partial class ChannelActivations
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelActivations"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 75;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ChannelActivations"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ChannelActivations"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ChannelActivations"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ChannelActivations"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ChannelActivations"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelActivations"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ChannelActivations"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelActivations"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ChannelActivations register.
+    /// </summary>
+    /// <seealso cref="ChannelActivations"/>
+    [Description("Filters and selects timestamped messages from the ChannelActivations register.")]
+    public partial class TimestampedChannelActivations
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelActivations"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ChannelActivations.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ChannelActivations"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return ChannelActivations.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time, in milliseconds, each audio channel was enabled since the last reset.
+    /// </summary>
+    [Description("Time, in milliseconds, each audio channel was enabled since the last reset.")]
+    public partial class ChannelOnTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelOnTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 76;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ChannelOnTime"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ChannelOnTime"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ChannelOnTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ChannelOnTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ChannelOnTime"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelOnTime"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ChannelOnTime"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelOnTime"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ChannelOnTime register.
+    /// </summary>
+    /// <seealso cref="ChannelOnTime"/>
+    [Description("Filters and selects timestamped messages from the ChannelOnTime register.")]
+    public partial class TimestampedChannelOnTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelOnTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ChannelOnTime.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ChannelOnTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return ChannelOnTime.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of channel switches (first element) and digital input changes (second element) not reported because their event is disabled in EnableEvents. Not counted in Standby Mode.
+    /// </summary>
+    [Description("Number of channel switches (first element) and digital input changes (second element) not reported because their event is disabled in EnableEvents. Not counted in Standby Mode.")]
+    public partial class EventsSuppressed
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventsSuppressed"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 77;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EventsSuppressed"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EventsSuppressed"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EventsSuppressed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EventsSuppressed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EventsSuppressed"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventsSuppressed"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EventsSuppressed"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventsSuppressed"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EventsSuppressed register.
+    /// </summary>
+    /// <seealso cref="EventsSuppressed"/>
+    [Description("Filters and selects timestamped messages from the EventsSuppressed register.")]
+    public partial class TimestampedEventsSuppressed
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventsSuppressed"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EventsSuppressed.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EventsSuppressed"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return EventsSuppressed.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of channel switches caused by the digital inputs, the sequence, the sweep or the channel set/clear/toggle registers that were not reported by an event. The event may be disabled, the device may be in Standby Mode, or the event queue may be full.
+    /// </summary>
+    [Description("Number of channel switches caused by the digital inputs, the sequence, the sweep or the channel set/clear/toggle registers that were not reported by an event. The event may be disabled, the device may be in Standby Mode, or the event queue may be full.")]
+    public partial class SilentSwitches
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SilentSwitches"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 78;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SilentSwitches"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SilentSwitches"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SilentSwitches"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SilentSwitches"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SilentSwitches"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SilentSwitches"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SilentSwitches"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SilentSwitches"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SilentSwitches register.
+    /// </summary>
+    /// <seealso cref="SilentSwitches"/>
+    [Description("Filters and selects timestamped messages from the SilentSwitches register.")]
+    public partial class TimestampedSilentSwitches
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SilentSwitches"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SilentSwitches.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SilentSwitches"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return SilentSwitches.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that registers 32 to 39 read at the same instant, in address order. The bytes are ControlMode, EnableChannels (low byte, high byte), DigitalInputState, DO0State, Reserved0, DI4Trigger, DO0Sync and EnableEvents.
+    /// </summary>
+    [Description("Registers 32 to 39 read at the same instant, in address order. The bytes are ControlMode, EnableChannels (low byte, high byte), DigitalInputState, DO0State, Reserved0, DI4Trigger, DO0Sync and EnableEvents.")]
+    public partial class Snapshot
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Snapshot"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 79;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Snapshot"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Snapshot"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 9;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Snapshot"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Snapshot"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Snapshot"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Snapshot"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Snapshot"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Snapshot"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Snapshot register.
+    /// </summary>
+    /// <seealso cref="Snapshot"/>
+    [Description("Filters and selects timestamped messages from the Snapshot register.")]
+    public partial class TimestampedSnapshot
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Snapshot"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Snapshot.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Snapshot"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return Snapshot.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that cRC-16 (CCITT, initial value 0xFFFF) of the configuration registers, recomputed outside interrupt context shortly after every write. Covers ControlMode, DI4Trigger, DO0Sync, EnableEvents, SwitchPolicy, SwitchDeadTime, InputsPriority, EventCoalesceWindow, Presets, GateInputs, the sweep configuration (SweepChannels, SweepDwell, SweepOrder, SweepSeed, SweepRepeats), DO0PulseWidth, DO0CodeUnit, DeglitchTime and StreamKeepAlive. A host can skip writing the configuration when the value matches the one it last read.
+    /// </summary>
+    [Description("CRC-16 (CCITT, initial value 0xFFFF) of the configuration registers, recomputed outside interrupt context shortly after every write. Covers ControlMode, DI4Trigger, DO0Sync, EnableEvents, SwitchPolicy, SwitchDeadTime, InputsPriority, EventCoalesceWindow, Presets, GateInputs, the sweep configuration (SweepChannels, SweepDwell, SweepOrder, SweepSeed, SweepRepeats), DO0PulseWidth, DO0CodeUnit, DeglitchTime and StreamKeepAlive. A host can skip writing the configuration when the value matches the one it last read.")]
+    public partial class ConfigCrc
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ConfigCrc"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 80;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ConfigCrc"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ConfigCrc"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ConfigCrc"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ConfigCrc"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ConfigCrc"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ConfigCrc"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ConfigCrc"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ConfigCrc"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ConfigCrc register.
+    /// </summary>
+    /// <seealso cref="ConfigCrc"/>
+    [Description("Filters and selects timestamped messages from the ConfigCrc register.")]
+    public partial class TimestampedConfigCrc
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ConfigCrc"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ConfigCrc.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ConfigCrc"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return ConfigCrc.GetTimestampedPayload(message);
+        }
+    }
+
     /// <summary>
     /// Represents an operator which creates standard message payloads for the
     /// AudioSwitch device.
     /// </summary>
-    /// <seealso cref="CreateControlModePayload"/>
-    /// <seealso cref="CreateEnableChannelsPayload"/>
-    /// <seealso cref="CreateDigitalInputStatePayload"/>
-    /// <seealso cref="CreateDO0StatePayload"/>
-    /// <seealso cref="CreateDI4TriggerPayload"/>
-    /// <seealso cref="CreateDO0SyncPayload"/>
-    /// <seealso cref="CreateEnableEventsPayload"/>
-    [XmlInclude(typeof(CreateControlModePayload))]
-    [XmlInclude(typeof(CreateEnableChannelsPayload))]
-    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateDO0StatePayload))]
-    [XmlInclude(typeof(CreateDI4TriggerPayload))]
-    [XmlInclude(typeof(CreateDO0SyncPayload))]
-    [XmlInclude(typeof(CreateEnableEventsPayload))]
-    [XmlInclude(typeof(CreateTimestampedControlModePayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableChannelsPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0StatePayload))]
-    [XmlInclude(typeof(CreateTimestampedDI4TriggerPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0SyncPayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
-    [Description("Creates standard message payloads for the AudioSwitch device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    /// <seealso cref="CreateControlModePayload"/>
+    /// <seealso cref="CreateEnableChannelsPayload"/>
+    /// <seealso cref="CreateDigitalInputStatePayload"/>
+    /// <seealso cref="CreateDO0StatePayload"/>
+    /// <seealso cref="CreateDI4TriggerPayload"/>
+    /// <seealso cref="CreateDO0SyncPayload"/>
+    /// <seealso cref="CreateEnableEventsPayload"/>
+    /// <seealso cref="CreateSwitchPolicyPayload"/>
+    /// <seealso cref="CreateSwitchDeadTimePayload"/>
+    /// <seealso cref="CreateInputsPriorityPayload"/>
+    /// <seealso cref="CreateEventQueueOverflowsPayload"/>
+    /// <seealso cref="CreateEventCoalesceWindowPayload"/>
+    /// <seealso cref="CreateEventCoalescedEdgesPayload"/>
+    /// <seealso cref="CreateIoStatePayload"/>
+    /// <seealso cref="CreateSequenceAppendPayload"/>
+    /// <seealso cref="CreateSequenceControlPayload"/>
+    /// <seealso cref="CreateSequenceStatusPayload"/>
+    /// <seealso cref="CreateSequenceUnderrunsPayload"/>
+    /// <seealso cref="CreateArmedChannelsPayload"/>
+    /// <seealso cref="CreateArmTriggerPayload"/>
+    /// <seealso cref="CreateEnableChannelsSetPayload"/>
+    /// <seealso cref="CreateEnableChannelsClearPayload"/>
+    /// <seealso cref="CreateEnableChannelsTogglePayload"/>
+    /// <seealso cref="CreatePresetsPayload"/>
+    /// <seealso cref="CreateGateInputsPayload"/>
+    /// <seealso cref="CreateSweepChannelsPayload"/>
+    /// <seealso cref="CreateSweepDwellPayload"/>
+    /// <seealso cref="CreateSweepOrderPayload"/>
+    /// <seealso cref="CreateSweepSeedPayload"/>
+    /// <seealso cref="CreateSweepRepeatsPayload"/>
+    /// <seealso cref="CreateSweepControlPayload"/>
+    /// <seealso cref="CreateDO0PulseWidthPayload"/>
+    /// <seealso cref="CreateDO0CodeUnitPayload"/>
+    /// <seealso cref="CreateDeglitchTimePayload"/>
+    /// <seealso cref="CreateDeglitchRejectsPayload"/>
+    /// <seealso cref="CreateStreamKeepAlivePayload"/>
+    /// <seealso cref="CreateEdgeHistoryPayload"/>
+    /// <seealso cref="CreateEdgeHeadPayload"/>
+    /// <seealso cref="CreateEdgeTailPayload"/>
+    /// <seealso cref="CreateLatencyExternalPayload"/>
+    /// <seealso cref="CreateLatencyUsbPayload"/>
+    /// <seealso cref="CreateLatencyClearPayload"/>
+    /// <seealso cref="CreateChannelActivationsPayload"/>
+    /// <seealso cref="CreateChannelOnTimePayload"/>
+    /// <seealso cref="CreateEventsSuppressedPayload"/>
+    /// <seealso cref="CreateSilentSwitchesPayload"/>
+    /// <seealso cref="CreateSnapshotPayload"/>
+    /// <seealso cref="CreateConfigCrcPayload"/>
+    [XmlInclude(typeof(CreateControlModePayload))]
+    [XmlInclude(typeof(CreateEnableChannelsPayload))]
+    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateDO0StatePayload))]
+    [XmlInclude(typeof(CreateDI4TriggerPayload))]
+    [XmlInclude(typeof(CreateDO0SyncPayload))]
+    [XmlInclude(typeof(CreateEnableEventsPayload))]
+    [XmlInclude(typeof(CreateSwitchPolicyPayload))]
+    [XmlInclude(typeof(CreateSwitchDeadTimePayload))]
+    [XmlInclude(typeof(CreateInputsPriorityPayload))]
+    [XmlInclude(typeof(CreateEventQueueOverflowsPayload))]
+    [XmlInclude(typeof(CreateEventCoalesceWindowPayload))]
+    [XmlInclude(typeof(CreateEventCoalescedEdgesPayload))]
+    [XmlInclude(typeof(CreateIoStatePayload))]
+    [XmlInclude(typeof(CreateSequenceAppendPayload))]
+    [XmlInclude(typeof(CreateSequenceControlPayload))]
+    [XmlInclude(typeof(CreateSequenceStatusPayload))]
+    [XmlInclude(typeof(CreateSequenceUnderrunsPayload))]
+    [XmlInclude(typeof(CreateArmedChannelsPayload))]
+    [XmlInclude(typeof(CreateArmTriggerPayload))]
+    [XmlInclude(typeof(CreateEnableChannelsSetPayload))]
+    [XmlInclude(typeof(CreateEnableChannelsClearPayload))]
+    [XmlInclude(typeof(CreateEnableChannelsTogglePayload))]
+    [XmlInclude(typeof(CreatePresetsPayload))]
+    [XmlInclude(typeof(CreateGateInputsPayload))]
+    [XmlInclude(typeof(CreateSweepChannelsPayload))]
+    [XmlInclude(typeof(CreateSweepDwellPayload))]
+    [XmlInclude(typeof(CreateSweepOrderPayload))]
+    [XmlInclude(typeof(CreateSweepSeedPayload))]
+    [XmlInclude(typeof(CreateSweepRepeatsPayload))]
+    [XmlInclude(typeof(CreateSweepControlPayload))]
+    [XmlInclude(typeof(CreateDO0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateDO0CodeUnitPayload))]
+    [XmlInclude(typeof(CreateDeglitchTimePayload))]
+    [XmlInclude(typeof(CreateDeglitchRejectsPayload))]
+    [XmlInclude(typeof(CreateStreamKeepAlivePayload))]
+    [XmlInclude(typeof(CreateEdgeHistoryPayload))]
+    [XmlInclude(typeof(CreateEdgeHeadPayload))]
+    [XmlInclude(typeof(CreateEdgeTailPayload))]
+    [XmlInclude(typeof(CreateLatencyExternalPayload))]
+    [XmlInclude(typeof(CreateLatencyUsbPayload))]
+    [XmlInclude(typeof(CreateLatencyClearPayload))]
+    [XmlInclude(typeof(CreateChannelActivationsPayload))]
+    [XmlInclude(typeof(CreateChannelOnTimePayload))]
+    [XmlInclude(typeof(CreateEventsSuppressedPayload))]
+    [XmlInclude(typeof(CreateSilentSwitchesPayload))]
+    [XmlInclude(typeof(CreateSnapshotPayload))]
+    [XmlInclude(typeof(CreateConfigCrcPayload))]
+    [XmlInclude(typeof(CreateTimestampedControlModePayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableChannelsPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0StatePayload))]
+    [XmlInclude(typeof(CreateTimestampedDI4TriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0SyncPayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSwitchPolicyPayload))]
+    [XmlInclude(typeof(CreateTimestampedSwitchDeadTimePayload))]
+    [XmlInclude(typeof(CreateTimestampedInputsPriorityPayload))]
+    [XmlInclude(typeof(CreateTimestampedEventQueueOverflowsPayload))]
+    [XmlInclude(typeof(CreateTimestampedEventCoalesceWindowPayload))]
+    [XmlInclude(typeof(CreateTimestampedEventCoalescedEdgesPayload))]
+    [XmlInclude(typeof(CreateTimestampedIoStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceAppendPayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceStatusPayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceUnderrunsPayload))]
+    [XmlInclude(typeof(CreateTimestampedArmedChannelsPayload))]
+    [XmlInclude(typeof(CreateTimestampedArmTriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableChannelsSetPayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableChannelsClearPayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableChannelsTogglePayload))]
+    [XmlInclude(typeof(CreateTimestampedPresetsPayload))]
+    [XmlInclude(typeof(CreateTimestampedGateInputsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSweepChannelsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSweepDwellPayload))]
+    [XmlInclude(typeof(CreateTimestampedSweepOrderPayload))]
+    [XmlInclude(typeof(CreateTimestampedSweepSeedPayload))]
+    [XmlInclude(typeof(CreateTimestampedSweepRepeatsPayload))]
+    [XmlInclude(typeof(CreateTimestampedSweepControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0CodeUnitPayload))]
+    [XmlInclude(typeof(CreateTimestampedDeglitchTimePayload))]
+    [XmlInclude(typeof(CreateTimestampedDeglitchRejectsPayload))]
+    [XmlInclude(typeof(CreateTimestampedStreamKeepAlivePayload))]
+    [XmlInclude(typeof(CreateTimestampedEdgeHistoryPayload))]
+    [XmlInclude(typeof(CreateTimestampedEdgeHeadPayload))]
+    [XmlInclude(typeof(CreateTimestampedEdgeTailPayload))]
+    [XmlInclude(typeof(CreateTimestampedLatencyExternalPayload))]
+    [XmlInclude(typeof(CreateTimestampedLatencyUsbPayload))]
+    [XmlInclude(typeof(CreateTimestampedLatencyClearPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannelActivationsPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannelOnTimePayload))]
+    [XmlInclude(typeof(CreateTimestampedEventsSuppressedPayload))]
+    [XmlInclude(typeof(CreateTimestampedSilentSwitchesPayload))]
+    [XmlInclude(typeof(CreateTimestampedSnapshotPayload))]
+    [XmlInclude(typeof(CreateTimestampedConfigCrcPayload))]
+    [Description("Creates standard message payloads for the AudioSwitch device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreateControlModePayload();
+        }
+
+        string INamedElement.Name => $"{nameof(AudioSwitch)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the source to enable the board channels.
+    /// </summary>
+    [DisplayName("ControlModePayload")]
+    [Description("Creates a message payload that configures the source to enable the board channels.")]
+    public partial class CreateControlModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the source to enable the board channels.
+        /// </summary>
+        [Description("The value that configures the source to enable the board channels.")]
+        public ControlSource ControlMode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ControlMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ControlSource GetPayload()
+        {
+            return ControlMode;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the source to enable the board channels.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ControlMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.ControlMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the source to enable the board channels.
+    /// </summary>
+    [DisplayName("TimestampedControlModePayload")]
+    [Description("Creates a timestamped message payload that configures the source to enable the board channels.")]
+    public partial class CreateTimestampedControlModePayload : CreateControlModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the source to enable the board channels.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ControlMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.ControlMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.
+    /// </summary>
+    [DisplayName("EnableChannelsPayload")]
+    [Description("Creates a message payload that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.")]
+    public partial class CreateEnableChannelsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.
+        /// </summary>
+        [Description("The value that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.")]
+        public AudioChannels EnableChannels { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableChannels register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AudioChannels GetPayload()
+        {
+            return EnableChannels;
+        }
+
+        /// <summary>
+        /// Creates a message that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableChannels register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.EnableChannels.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.
+    /// </summary>
+    [DisplayName("TimestampedEnableChannelsPayload")]
+    [Description("Creates a timestamped message payload that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.")]
+    public partial class CreateTimestampedEnableChannelsPayload : CreateEnableChannelsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableChannels register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.EnableChannels.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+    /// </summary>
+    [DisplayName("DigitalInputStatePayload")]
+    [Description("Creates a message payload that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.")]
+    public partial class CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+        /// </summary>
+        [Description("The value that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.")]
+        public DigitalInputs DigitalInputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DigitalInputState;
+        }
+
+        /// <summary>
+        /// Creates a message that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.DigitalInputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputStatePayload")]
+    [Description("Creates a timestamped message payload that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.")]
+    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that status of the digital output pin 0.
+    /// </summary>
+    [DisplayName("DO0StatePayload")]
+    [Description("Creates a message payload that status of the digital output pin 0.")]
+    public partial class CreateDO0StatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that status of the digital output pin 0.
+        /// </summary>
+        [Description("The value that status of the digital output pin 0.")]
+        public EnableFlag DO0State { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0State register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return DO0State;
+        }
+
+        /// <summary>
+        /// Creates a message that status of the digital output pin 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0State register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.DO0State.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that status of the digital output pin 0.
+    /// </summary>
+    [DisplayName("TimestampedDO0StatePayload")]
+    [Description("Creates a timestamped message payload that status of the digital output pin 0.")]
+    public partial class CreateTimestampedDO0StatePayload : CreateDO0StatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that status of the digital output pin 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0State register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.DO0State.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configuration of the digital input pin 4 functionality.
+    /// </summary>
+    [DisplayName("DI4TriggerPayload")]
+    [Description("Creates a message payload that configuration of the digital input pin 4 functionality.")]
+    public partial class CreateDI4TriggerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configuration of the digital input pin 4 functionality.
+        /// </summary>
+        [Description("The value that configuration of the digital input pin 4 functionality.")]
+        public DI4TriggerConfig DI4Trigger { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DI4Trigger register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DI4TriggerConfig GetPayload()
+        {
+            return DI4Trigger;
+        }
+
+        /// <summary>
+        /// Creates a message that configuration of the digital input pin 4 functionality.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DI4Trigger register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.DI4Trigger.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configuration of the digital input pin 4 functionality.
+    /// </summary>
+    [DisplayName("TimestampedDI4TriggerPayload")]
+    [Description("Creates a timestamped message payload that configuration of the digital input pin 4 functionality.")]
+    public partial class CreateTimestampedDI4TriggerPayload : CreateDI4TriggerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configuration of the digital input pin 4 functionality.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DI4Trigger register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.DI4Trigger.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configuration of the digital output pin 0 functionality.
+    /// </summary>
+    [DisplayName("DO0SyncPayload")]
+    [Description("Creates a message payload that configuration of the digital output pin 0 functionality.")]
+    public partial class CreateDO0SyncPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configuration of the digital output pin 0 functionality.
+        /// </summary>
+        [Description("The value that configuration of the digital output pin 0 functionality.")]
+        public DO0SyncConfig DO0Sync { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0Sync register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DO0SyncConfig GetPayload()
+        {
+            return DO0Sync;
+        }
+
+        /// <summary>
+        /// Creates a message that configuration of the digital output pin 0 functionality.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0Sync register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.DO0Sync.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configuration of the digital output pin 0 functionality.
+    /// </summary>
+    [DisplayName("TimestampedDO0SyncPayload")]
+    [Description("Creates a timestamped message payload that configuration of the digital output pin 0 functionality.")]
+    public partial class CreateTimestampedDO0SyncPayload : CreateDO0SyncPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configuration of the digital output pin 0 functionality.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0Sync register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.DO0Sync.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the active events in the device.
+    /// </summary>
+    [DisplayName("EnableEventsPayload")]
+    [Description("Creates a message payload that specifies the active events in the device.")]
+    public partial class CreateEnableEventsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the active events in the device.
+        /// </summary>
+        [Description("The value that specifies the active events in the device.")]
+        public AudioSwitchEvents EnableEvents { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableEvents register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AudioSwitchEvents GetPayload()
+        {
+            return EnableEvents;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the active events in the device.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableEvents register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.EnableEvents.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the active events in the device.
+    /// </summary>
+    [DisplayName("TimestampedEnableEventsPayload")]
+    [Description("Creates a timestamped message payload that specifies the active events in the device.")]
+    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the active events in the device.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableEvents register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures how a new channel mask is committed to the audio output channels.
+    /// </summary>
+    [DisplayName("SwitchPolicyPayload")]
+    [Description("Creates a message payload that configures how a new channel mask is committed to the audio output channels.")]
+    public partial class CreateSwitchPolicyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures how a new channel mask is committed to the audio output channels.
+        /// </summary>
+        [Description("The value that configures how a new channel mask is committed to the audio output channels.")]
+        public SwitchPolicyConfig SwitchPolicy { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SwitchPolicy register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SwitchPolicyConfig GetPayload()
+        {
+            return SwitchPolicy;
+        }
+
+        /// <summary>
+        /// Creates a message that configures how a new channel mask is committed to the audio output channels.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SwitchPolicy register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.SwitchPolicy.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures how a new channel mask is committed to the audio output channels.
+    /// </summary>
+    [DisplayName("TimestampedSwitchPolicyPayload")]
+    [Description("Creates a timestamped message payload that configures how a new channel mask is committed to the audio output channels.")]
+    public partial class CreateTimestampedSwitchPolicyPayload : CreateSwitchPolicyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures how a new channel mask is committed to the audio output channels.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SwitchPolicy register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.SwitchPolicy.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that dead time, in microseconds, between disabling and enabling channels when using the break-before-make policy.
+    /// </summary>
+    [DisplayName("SwitchDeadTimePayload")]
+    [Description("Creates a message payload that dead time, in microseconds, between disabling and enabling channels when using the break-before-make policy.")]
+    public partial class CreateSwitchDeadTimePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that dead time, in microseconds, between disabling and enabling channels when using the break-before-make policy.
+        /// </summary>
+        [Description("The value that dead time, in microseconds, between disabling and enabling channels when using the break-before-make policy.")]
+        public ushort SwitchDeadTime { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SwitchDeadTime register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SwitchDeadTime;
+        }
+
+        /// <summary>
+        /// Creates a message that dead time, in microseconds, between disabling and enabling channels when using the break-before-make policy.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SwitchDeadTime register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.SwitchDeadTime.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that dead time, in microseconds, between disabling and enabling channels when using the break-before-make policy.
+    /// </summary>
+    [DisplayName("TimestampedSwitchDeadTimePayload")]
+    [Description("Creates a timestamped message payload that dead time, in microseconds, between disabling and enabling channels when using the break-before-make policy.")]
+    public partial class CreateTimestampedSwitchDeadTimePayload : CreateSwitchDeadTimePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that dead time, in microseconds, between disabling and enabling channels when using the break-before-make policy.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SwitchDeadTime register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.SwitchDeadTime.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the interrupt priority of the digital inputs used to switch the audio output channels.
+    /// </summary>
+    [DisplayName("InputsPriorityPayload")]
+    [Description("Creates a message payload that configures the interrupt priority of the digital inputs used to switch the audio output channels.")]
+    public partial class CreateInputsPriorityPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the interrupt priority of the digital inputs used to switch the audio output channels.
+        /// </summary>
+        [Description("The value that configures the interrupt priority of the digital inputs used to switch the audio output channels.")]
+        public InputsPriorityConfig InputsPriority { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the InputsPriority register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public InputsPriorityConfig GetPayload()
+        {
+            return InputsPriority;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the interrupt priority of the digital inputs used to switch the audio output channels.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the InputsPriority register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.InputsPriority.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the interrupt priority of the digital inputs used to switch the audio output channels.
+    /// </summary>
+    [DisplayName("TimestampedInputsPriorityPayload")]
+    [Description("Creates a timestamped message payload that configures the interrupt priority of the digital inputs used to switch the audio output channels.")]
+    public partial class CreateTimestampedInputsPriorityPayload : CreateInputsPriorityPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the interrupt priority of the digital inputs used to switch the audio output channels.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the InputsPriority register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.InputsPriority.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of events lost because the firmware event queue was full.
+    /// </summary>
+    [DisplayName("EventQueueOverflowsPayload")]
+    [Description("Creates a message payload that number of events lost because the firmware event queue was full.")]
+    public partial class CreateEventQueueOverflowsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of events lost because the firmware event queue was full.
+        /// </summary>
+        [Description("The value that number of events lost because the firmware event queue was full.")]
+        public ushort EventQueueOverflows { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EventQueueOverflows register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return EventQueueOverflows;
+        }
+
+        /// <summary>
+        /// Creates a message that number of events lost because the firmware event queue was full.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EventQueueOverflows register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.EventQueueOverflows.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of events lost because the firmware event queue was full.
+    /// </summary>
+    [DisplayName("TimestampedEventQueueOverflowsPayload")]
+    [Description("Creates a timestamped message payload that number of events lost because the firmware event queue was full.")]
+    public partial class CreateTimestampedEventQueueOverflowsPayload : CreateEventQueueOverflowsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of events lost because the firmware event queue was full.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EventQueueOverflows register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.EventQueueOverflows.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that window, in milliseconds, used to coalesce the EnableChannels, DigitalInputState and IoState events. Ignored in Speed Mode, where every IoState event is sent. At most one event per register is sent per window, carrying the latest state. A value of 0 sends every event.
+    /// </summary>
+    [DisplayName("EventCoalesceWindowPayload")]
+    [Description("Creates a message payload that window, in milliseconds, used to coalesce the EnableChannels, DigitalInputState and IoState events. Ignored in Speed Mode, where every IoState event is sent. At most one event per register is sent per window, carrying the latest state. A value of 0 sends every event.")]
+    public partial class CreateEventCoalesceWindowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that window, in milliseconds, used to coalesce the EnableChannels, DigitalInputState and IoState events. Ignored in Speed Mode, where every IoState event is sent. At most one event per register is sent per window, carrying the latest state. A value of 0 sends every event.
+        /// </summary>
+        [Description("The value that window, in milliseconds, used to coalesce the EnableChannels, DigitalInputState and IoState events. Ignored in Speed Mode, where every IoState event is sent. At most one event per register is sent per window, carrying the latest state. A value of 0 sends every event.")]
+        public byte EventCoalesceWindow { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EventCoalesceWindow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return EventCoalesceWindow;
+        }
+
+        /// <summary>
+        /// Creates a message that window, in milliseconds, used to coalesce the EnableChannels, DigitalInputState and IoState events. Ignored in Speed Mode, where every IoState event is sent. At most one event per register is sent per window, carrying the latest state. A value of 0 sends every event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EventCoalesceWindow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.EventCoalesceWindow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that window, in milliseconds, used to coalesce the EnableChannels, DigitalInputState and IoState events. Ignored in Speed Mode, where every IoState event is sent. At most one event per register is sent per window, carrying the latest state. A value of 0 sends every event.
+    /// </summary>
+    [DisplayName("TimestampedEventCoalesceWindowPayload")]
+    [Description("Creates a timestamped message payload that window, in milliseconds, used to coalesce the EnableChannels, DigitalInputState and IoState events. Ignored in Speed Mode, where every IoState event is sent. At most one event per register is sent per window, carrying the latest state. A value of 0 sends every event.")]
+    public partial class CreateTimestampedEventCoalesceWindowPayload : CreateEventCoalesceWindowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that window, in milliseconds, used to coalesce the EnableChannels, DigitalInputState and IoState events. Ignored in Speed Mode, where every IoState event is sent. At most one event per register is sent per window, carrying the latest state. A value of 0 sends every event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EventCoalesceWindow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.EventCoalesceWindow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of edges folded into the last coalesced EnableChannels, DigitalInputState and IoState events, in this order. Sent at the end of each window where edges were folded, when enabled in EnableEvents.
+    /// </summary>
+    [DisplayName("EventCoalescedEdgesPayload")]
+    [Description("Creates a message payload that number of edges folded into the last coalesced EnableChannels, DigitalInputState and IoState events, in this order. Sent at the end of each window where edges were folded, when enabled in EnableEvents.")]
+    public partial class CreateEventCoalescedEdgesPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of edges folded into the last coalesced EnableChannels, DigitalInputState and IoState events, in this order. Sent at the end of each window where edges were folded, when enabled in EnableEvents.
+        /// </summary>
+        [Description("The value that number of edges folded into the last coalesced EnableChannels, DigitalInputState and IoState events, in this order. Sent at the end of each window where edges were folded, when enabled in EnableEvents.")]
+        public ushort[] EventCoalescedEdges { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EventCoalescedEdges register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return EventCoalescedEdges;
+        }
+
+        /// <summary>
+        /// Creates a message that number of edges folded into the last coalesced EnableChannels, DigitalInputState and IoState events, in this order. Sent at the end of each window where edges were folded, when enabled in EnableEvents.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EventCoalescedEdges register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.EventCoalescedEdges.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of edges folded into the last coalesced EnableChannels, DigitalInputState and IoState events, in this order. Sent at the end of each window where edges were folded, when enabled in EnableEvents.
+    /// </summary>
+    [DisplayName("TimestampedEventCoalescedEdgesPayload")]
+    [Description("Creates a timestamped message payload that number of edges folded into the last coalesced EnableChannels, DigitalInputState and IoState events, in this order. Sent at the end of each window where edges were folded, when enabled in EnableEvents.")]
+    public partial class CreateTimestampedEventCoalescedEdgesPayload : CreateEventCoalescedEdgesPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of edges folded into the last coalesced EnableChannels, DigitalInputState and IoState events, in this order. Sent at the end of each window where edges were folded, when enabled in EnableEvents.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EventCoalescedEdges register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.EventCoalescedEdges.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that combined state of the board. Bits 0 to 15 are the enabled channels, bits 16 to 20 the digital inputs and bit 24 the state of DO0. Sent instead of the EnableChannels and DigitalInputState events when the IoState event is enabled.
+    /// </summary>
+    [DisplayName("IoStatePayload")]
+    [Description("Creates a message payload that combined state of the board. Bits 0 to 15 are the enabled channels, bits 16 to 20 the digital inputs and bit 24 the state of DO0. Sent instead of the EnableChannels and DigitalInputState events when the IoState event is enabled.")]
+    public partial class CreateIoStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that combined state of the board. Bits 0 to 15 are the enabled channels, bits 16 to 20 the digital inputs and bit 24 the state of DO0. Sent instead of the EnableChannels and DigitalInputState events when the IoState event is enabled.
+        /// </summary>
+        [Description("The value that combined state of the board. Bits 0 to 15 are the enabled channels, bits 16 to 20 the digital inputs and bit 24 the state of DO0. Sent instead of the EnableChannels and DigitalInputState events when the IoState event is enabled.")]
+        public uint IoState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the IoState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return IoState;
+        }
+
+        /// <summary>
+        /// Creates a message that combined state of the board. Bits 0 to 15 are the enabled channels, bits 16 to 20 the digital inputs and bit 24 the state of DO0. Sent instead of the EnableChannels and DigitalInputState events when the IoState event is enabled.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the IoState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.IoState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that combined state of the board. Bits 0 to 15 are the enabled channels, bits 16 to 20 the digital inputs and bit 24 the state of DO0. Sent instead of the EnableChannels and DigitalInputState events when the IoState event is enabled.
+    /// </summary>
+    [DisplayName("TimestampedIoStatePayload")]
+    [Description("Creates a timestamped message payload that combined state of the board. Bits 0 to 15 are the enabled channels, bits 16 to 20 the digital inputs and bit 24 the state of DO0. Sent instead of the EnableChannels and DigitalInputState events when the IoState event is enabled.")]
+    public partial class CreateTimestampedIoStatePayload : CreateIoStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that combined state of the board. Bits 0 to 15 are the enabled channels, bits 16 to 20 the digital inputs and bit 24 the state of DO0. Sent instead of the EnableChannels and DigitalInputState events when the IoState event is enabled.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the IoState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.IoState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that appends an entry to the channel sequence table. Elements 0 and 1 are the low and high words of the Harp timestamp seconds, element 2 the Harp timestamp microseconds in units of 32 us, and element 3 the channel mask applied at that time.
+    /// </summary>
+    [DisplayName("SequenceAppendPayload")]
+    [Description("Creates a message payload that appends an entry to the channel sequence table. Elements 0 and 1 are the low and high words of the Harp timestamp seconds, element 2 the Harp timestamp microseconds in units of 32 us, and element 3 the channel mask applied at that time.")]
+    public partial class CreateSequenceAppendPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that appends an entry to the channel sequence table. Elements 0 and 1 are the low and high words of the Harp timestamp seconds, element 2 the Harp timestamp microseconds in units of 32 us, and element 3 the channel mask applied at that time.
+        /// </summary>
+        [Description("The value that appends an entry to the channel sequence table. Elements 0 and 1 are the low and high words of the Harp timestamp seconds, element 2 the Harp timestamp microseconds in units of 32 us, and element 3 the channel mask applied at that time.")]
+        public ushort[] SequenceAppend { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SequenceAppend register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return SequenceAppend;
+        }
+
+        /// <summary>
+        /// Creates a message that appends an entry to the channel sequence table. Elements 0 and 1 are the low and high words of the Harp timestamp seconds, element 2 the Harp timestamp microseconds in units of 32 us, and element 3 the channel mask applied at that time.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SequenceAppend register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.SequenceAppend.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that appends an entry to the channel sequence table. Elements 0 and 1 are the low and high words of the Harp timestamp seconds, element 2 the Harp timestamp microseconds in units of 32 us, and element 3 the channel mask applied at that time.
+    /// </summary>
+    [DisplayName("TimestampedSequenceAppendPayload")]
+    [Description("Creates a timestamped message payload that appends an entry to the channel sequence table. Elements 0 and 1 are the low and high words of the Harp timestamp seconds, element 2 the Harp timestamp microseconds in units of 32 us, and element 3 the channel mask applied at that time.")]
+    public partial class CreateTimestampedSequenceAppendPayload : CreateSequenceAppendPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that appends an entry to the channel sequence table. Elements 0 and 1 are the low and high words of the Harp timestamp seconds, element 2 the Harp timestamp microseconds in units of 32 us, and element 3 the channel mask applied at that time.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SequenceAppend register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.SequenceAppend.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that starts, stops or clears the channel sequence table. The sequence can only be started when the board is controlled by USB.
+    /// </summary>
+    [DisplayName("SequenceControlPayload")]
+    [Description("Creates a message payload that starts, stops or clears the channel sequence table. The sequence can only be started when the board is controlled by USB.")]
+    public partial class CreateSequenceControlPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that starts, stops or clears the channel sequence table. The sequence can only be started when the board is controlled by USB.
+        /// </summary>
+        [Description("The value that starts, stops or clears the channel sequence table. The sequence can only be started when the board is controlled by USB.")]
+        public SequenceControlConfig SequenceControl { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SequenceControl register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SequenceControlConfig GetPayload()
+        {
+            return SequenceControl;
+        }
+
+        /// <summary>
+        /// Creates a message that starts, stops or clears the channel sequence table. The sequence can only be started when the board is controlled by USB.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SequenceControl register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.SequenceControl.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that starts, stops or clears the channel sequence table. The sequence can only be started when the board is controlled by USB.
+    /// </summary>
+    [DisplayName("TimestampedSequenceControlPayload")]
+    [Description("Creates a timestamped message payload that starts, stops or clears the channel sequence table. The sequence can only be started when the board is controlled by USB.")]
+    public partial class CreateTimestampedSequenceControlPayload : CreateSequenceControlPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that starts, stops or clears the channel sequence table. The sequence can only be started when the board is controlled by USB.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SequenceControl register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.SequenceControl.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that bits 0 to 5 are the number of entries pending in the sequence table and bit 7 is set while the sequence runs. Sent when the sequence runs out of entries.
+    /// </summary>
+    [DisplayName("SequenceStatusPayload")]
+    [Description("Creates a message payload that bits 0 to 5 are the number of entries pending in the sequence table and bit 7 is set while the sequence runs. Sent when the sequence runs out of entries.")]
+    public partial class CreateSequenceStatusPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that bits 0 to 5 are the number of entries pending in the sequence table and bit 7 is set while the sequence runs. Sent when the sequence runs out of entries.
+        /// </summary>
+        [Description("The value that bits 0 to 5 are the number of entries pending in the sequence table and bit 7 is set while the sequence runs. Sent when the sequence runs out of entries.")]
+        public byte SequenceStatus { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SequenceStatus register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return SequenceStatus;
+        }
+
+        /// <summary>
+        /// Creates a message that bits 0 to 5 are the number of entries pending in the sequence table and bit 7 is set while the sequence runs. Sent when the sequence runs out of entries.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SequenceStatus register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.SequenceStatus.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that bits 0 to 5 are the number of entries pending in the sequence table and bit 7 is set while the sequence runs. Sent when the sequence runs out of entries.
+    /// </summary>
+    [DisplayName("TimestampedSequenceStatusPayload")]
+    [Description("Creates a timestamped message payload that bits 0 to 5 are the number of entries pending in the sequence table and bit 7 is set while the sequence runs. Sent when the sequence runs out of entries.")]
+    public partial class CreateTimestampedSequenceStatusPayload : CreateSequenceStatusPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that bits 0 to 5 are the number of entries pending in the sequence table and bit 7 is set while the sequence runs. Sent when the sequence runs out of entries.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SequenceStatus register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.SequenceStatus.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of sequence entries applied more than 1 ms after their timestamp.
+    /// </summary>
+    [DisplayName("SequenceUnderrunsPayload")]
+    [Description("Creates a message payload that number of sequence entries applied more than 1 ms after their timestamp.")]
+    public partial class CreateSequenceUnderrunsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of sequence entries applied more than 1 ms after their timestamp.
+        /// </summary>
+        [Description("The value that number of sequence entries applied more than 1 ms after their timestamp.")]
+        public ushort SequenceUnderruns { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SequenceUnderruns register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SequenceUnderruns;
+        }
+
+        /// <summary>
+        /// Creates a message that number of sequence entries applied more than 1 ms after their timestamp.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SequenceUnderruns register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.SequenceUnderruns.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of sequence entries applied more than 1 ms after their timestamp.
+    /// </summary>
+    [DisplayName("TimestampedSequenceUnderrunsPayload")]
+    [Description("Creates a timestamped message payload that number of sequence entries applied more than 1 ms after their timestamp.")]
+    public partial class CreateTimestampedSequenceUnderrunsPayload : CreateSequenceUnderrunsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of sequence entries applied more than 1 ms after their timestamp.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SequenceUnderruns register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.SequenceUnderruns.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that channel mask applied to the audio output channels on the next trigger edge. Writing it arms the trigger. Only accepted when the board is controlled by USB.
+    /// </summary>
+    [DisplayName("ArmedChannelsPayload")]
+    [Description("Creates a message payload that channel mask applied to the audio output channels on the next trigger edge. Writing it arms the trigger. Only accepted when the board is controlled by USB.")]
+    public partial class CreateArmedChannelsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that channel mask applied to the audio output channels on the next trigger edge. Writing it arms the trigger. Only accepted when the board is controlled by USB.
+        /// </summary>
+        [Description("The value that channel mask applied to the audio output channels on the next trigger edge. Writing it arms the trigger. Only accepted when the board is controlled by USB.")]
+        public AudioChannels ArmedChannels { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ArmedChannels register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AudioChannels GetPayload()
+        {
+            return ArmedChannels;
+        }
+
+        /// <summary>
+        /// Creates a message that channel mask applied to the audio output channels on the next trigger edge. Writing it arms the trigger. Only accepted when the board is controlled by USB.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ArmedChannels register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.ArmedChannels.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that channel mask applied to the audio output channels on the next trigger edge. Writing it arms the trigger. Only accepted when the board is controlled by USB.
+    /// </summary>
+    [DisplayName("TimestampedArmedChannelsPayload")]
+    [Description("Creates a timestamped message payload that channel mask applied to the audio output channels on the next trigger edge. Writing it arms the trigger. Only accepted when the board is controlled by USB.")]
+    public partial class CreateTimestampedArmedChannelsPayload : CreateArmedChannelsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that channel mask applied to the audio output channels on the next trigger edge. Writing it arms the trigger. Only accepted when the board is controlled by USB.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ArmedChannels register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.ArmedChannels.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that bits 0 to 2 select the digital input (0 to 4) and bits 4 and 5 the edges (1 rising, 2 falling, 3 both) that apply the armed channel mask. Bit 7 is read only and set while the trigger is armed.
+    /// </summary>
+    [DisplayName("ArmTriggerPayload")]
+    [Description("Creates a message payload that bits 0 to 2 select the digital input (0 to 4) and bits 4 and 5 the edges (1 rising, 2 falling, 3 both) that apply the armed channel mask. Bit 7 is read only and set while the trigger is armed.")]
+    public partial class CreateArmTriggerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that bits 0 to 2 select the digital input (0 to 4) and bits 4 and 5 the edges (1 rising, 2 falling, 3 both) that apply the armed channel mask. Bit 7 is read only and set while the trigger is armed.
+        /// </summary>
+        [Description("The value that bits 0 to 2 select the digital input (0 to 4) and bits 4 and 5 the edges (1 rising, 2 falling, 3 both) that apply the armed channel mask. Bit 7 is read only and set while the trigger is armed.")]
+        public byte ArmTrigger { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ArmTrigger register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return ArmTrigger;
+        }
+
+        /// <summary>
+        /// Creates a message that bits 0 to 2 select the digital input (0 to 4) and bits 4 and 5 the edges (1 rising, 2 falling, 3 both) that apply the armed channel mask. Bit 7 is read only and set while the trigger is armed.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ArmTrigger register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.ArmTrigger.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that bits 0 to 2 select the digital input (0 to 4) and bits 4 and 5 the edges (1 rising, 2 falling, 3 both) that apply the armed channel mask. Bit 7 is read only and set while the trigger is armed.
+    /// </summary>
+    [DisplayName("TimestampedArmTriggerPayload")]
+    [Description("Creates a timestamped message payload that bits 0 to 2 select the digital input (0 to 4) and bits 4 and 5 the edges (1 rising, 2 falling, 3 both) that apply the armed channel mask. Bit 7 is read only and set while the trigger is armed.")]
+    public partial class CreateTimestampedArmTriggerPayload : CreateArmTriggerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that bits 0 to 2 select the digital input (0 to 4) and bits 4 and 5 the edges (1 rising, 2 falling, 3 both) that apply the armed channel mask. Bit 7 is read only and set while the trigger is armed.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ArmTrigger register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.ArmTrigger.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+    /// </summary>
+    [DisplayName("EnableChannelsSetPayload")]
+    [Description("Creates a message payload that enables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.")]
+    public partial class CreateEnableChannelsSetPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+        /// </summary>
+        [Description("The value that enables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.")]
+        public AudioChannels EnableChannelsSet { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableChannelsSet register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AudioChannels GetPayload()
+        {
+            return EnableChannelsSet;
+        }
+
+        /// <summary>
+        /// Creates a message that enables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableChannelsSet register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.EnableChannelsSet.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+    /// </summary>
+    [DisplayName("TimestampedEnableChannelsSetPayload")]
+    [Description("Creates a timestamped message payload that enables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.")]
+    public partial class CreateTimestampedEnableChannelsSetPayload : CreateEnableChannelsSetPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableChannelsSet register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.EnableChannelsSet.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that disables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+    /// </summary>
+    [DisplayName("EnableChannelsClearPayload")]
+    [Description("Creates a message payload that disables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.")]
+    public partial class CreateEnableChannelsClearPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that disables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+        /// </summary>
+        [Description("The value that disables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.")]
+        public AudioChannels EnableChannelsClear { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableChannelsClear register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AudioChannels GetPayload()
+        {
+            return EnableChannelsClear;
+        }
+
+        /// <summary>
+        /// Creates a message that disables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableChannelsClear register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.EnableChannelsClear.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that disables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+    /// </summary>
+    [DisplayName("TimestampedEnableChannelsClearPayload")]
+    [Description("Creates a timestamped message payload that disables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.")]
+    public partial class CreateTimestampedEnableChannelsClearPayload : CreateEnableChannelsClearPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that disables the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableChannelsClear register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.EnableChannelsClear.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that toggles the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+    /// </summary>
+    [DisplayName("EnableChannelsTogglePayload")]
+    [Description("Creates a message payload that toggles the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.")]
+    public partial class CreateEnableChannelsTogglePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that toggles the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+        /// </summary>
+        [Description("The value that toggles the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.")]
+        public AudioChannels EnableChannelsToggle { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableChannelsToggle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AudioChannels GetPayload()
+        {
+            return EnableChannelsToggle;
+        }
+
+        /// <summary>
+        /// Creates a message that toggles the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableChannelsToggle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.EnableChannelsToggle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that toggles the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+    /// </summary>
+    [DisplayName("TimestampedEnableChannelsTogglePayload")]
+    [Description("Creates a timestamped message payload that toggles the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.")]
+    public partial class CreateTimestampedEnableChannelsTogglePayload : CreateEnableChannelsTogglePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that toggles the specified audio output channels, keeping the state of the others. Only accepted when the board is controlled by USB.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableChannelsToggle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.EnableChannelsToggle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that table of channel masks used by the DigitalInputsPresets source. DI0 to DI4 select the preset, or DI0 to DI3 when DI4 is used as address. Kept in EEPROM when the registers are saved.
+    /// </summary>
+    [DisplayName("PresetsPayload")]
+    [Description("Creates a message payload that table of channel masks used by the DigitalInputsPresets source. DI0 to DI4 select the preset, or DI0 to DI3 when DI4 is used as address. Kept in EEPROM when the registers are saved.")]
+    public partial class CreatePresetsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that table of channel masks used by the DigitalInputsPresets source. DI0 to DI4 select the preset, or DI0 to DI3 when DI4 is used as address. Kept in EEPROM when the registers are saved.
+        /// </summary>
+        [Description("The value that table of channel masks used by the DigitalInputsPresets source. DI0 to DI4 select the preset, or DI0 to DI3 when DI4 is used as address. Kept in EEPROM when the registers are saved.")]
+        public ushort[] Presets { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Presets register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return Presets;
+        }
+
+        /// <summary>
+        /// Creates a message that table of channel masks used by the DigitalInputsPresets source. DI0 to DI4 select the preset, or DI0 to DI3 when DI4 is used as address. Kept in EEPROM when the registers are saved.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Presets register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.Presets.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that table of channel masks used by the DigitalInputsPresets source. DI0 to DI4 select the preset, or DI0 to DI3 when DI4 is used as address. Kept in EEPROM when the registers are saved.
+    /// </summary>
+    [DisplayName("TimestampedPresetsPayload")]
+    [Description("Creates a timestamped message payload that table of channel masks used by the DigitalInputsPresets source. DI0 to DI4 select the preset, or DI0 to DI3 when DI4 is used as address. Kept in EEPROM when the registers are saved.")]
+    public partial class CreateTimestampedPresetsPayload : CreatePresetsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that table of channel masks used by the DigitalInputsPresets source. DI0 to DI4 select the preset, or DI0 to DI3 when DI4 is used as address. Kept in EEPROM when the registers are saved.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Presets register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.Presets.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that digital inputs that gate the host channel mask in the GatedUSB source. The channels are disabled while any of the selected inputs is low.
+    /// </summary>
+    [DisplayName("GateInputsPayload")]
+    [Description("Creates a message payload that digital inputs that gate the host channel mask in the GatedUSB source. The channels are disabled while any of the selected inputs is low.")]
+    public partial class CreateGateInputsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that digital inputs that gate the host channel mask in the GatedUSB source. The channels are disabled while any of the selected inputs is low.
+        /// </summary>
+        [Description("The value that digital inputs that gate the host channel mask in the GatedUSB source. The channels are disabled while any of the selected inputs is low.")]
+        public DigitalInputs GateInputs { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the GateInputs register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return GateInputs;
+        }
+
+        /// <summary>
+        /// Creates a message that digital inputs that gate the host channel mask in the GatedUSB source. The channels are disabled while any of the selected inputs is low.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the GateInputs register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.GateInputs.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that digital inputs that gate the host channel mask in the GatedUSB source. The channels are disabled while any of the selected inputs is low.
+    /// </summary>
+    [DisplayName("TimestampedGateInputsPayload")]
+    [Description("Creates a timestamped message payload that digital inputs that gate the host channel mask in the GatedUSB source. The channels are disabled while any of the selected inputs is low.")]
+    public partial class CreateTimestampedGateInputsPayload : CreateGateInputsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that digital inputs that gate the host channel mask in the GatedUSB source. The channels are disabled while any of the selected inputs is low.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the GateInputs register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.GateInputs.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that audio output channels enabled one at a time by the sweep.
+    /// </summary>
+    [DisplayName("SweepChannelsPayload")]
+    [Description("Creates a message payload that audio output channels enabled one at a time by the sweep.")]
+    public partial class CreateSweepChannelsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that audio output channels enabled one at a time by the sweep.
+        /// </summary>
+        [Description("The value that audio output channels enabled one at a time by the sweep.")]
+        public AudioChannels SweepChannels { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SweepChannels register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public AudioChannels GetPayload()
+        {
+            return SweepChannels;
+        }
+
+        /// <summary>
+        /// Creates a message that audio output channels enabled one at a time by the sweep.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SweepChannels register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.SweepChannels.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that audio output channels enabled one at a time by the sweep.
+    /// </summary>
+    [DisplayName("TimestampedSweepChannelsPayload")]
+    [Description("Creates a timestamped message payload that audio output channels enabled one at a time by the sweep.")]
+    public partial class CreateTimestampedSweepChannelsPayload : CreateSweepChannelsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that audio output channels enabled one at a time by the sweep.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SweepChannels register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.SweepChannels.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time, in microseconds, each channel of the sweep is enabled. The minimum is 100 us.
+    /// </summary>
+    [DisplayName("SweepDwellPayload")]
+    [Description("Creates a message payload that time, in microseconds, each channel of the sweep is enabled. The minimum is 100 us.")]
+    public partial class CreateSweepDwellPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time, in microseconds, each channel of the sweep is enabled. The minimum is 100 us.
+        /// </summary>
+        [Description("The value that time, in microseconds, each channel of the sweep is enabled. The minimum is 100 us.")]
+        public uint SweepDwell { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SweepDwell register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return SweepDwell;
+        }
+
+        /// <summary>
+        /// Creates a message that time, in microseconds, each channel of the sweep is enabled. The minimum is 100 us.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SweepDwell register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.SweepDwell.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time, in microseconds, each channel of the sweep is enabled. The minimum is 100 us.
+    /// </summary>
+    [DisplayName("TimestampedSweepDwellPayload")]
+    [Description("Creates a timestamped message payload that time, in microseconds, each channel of the sweep is enabled. The minimum is 100 us.")]
+    public partial class CreateTimestampedSweepDwellPayload : CreateSweepDwellPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time, in microseconds, each channel of the sweep is enabled. The minimum is 100 us.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SweepDwell register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.SweepDwell.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that order of the channels in each pass of the sweep.
+    /// </summary>
+    [DisplayName("SweepOrderPayload")]
+    [Description("Creates a message payload that order of the channels in each pass of the sweep.")]
+    public partial class CreateSweepOrderPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that order of the channels in each pass of the sweep.
+        /// </summary>
+        [Description("The value that order of the channels in each pass of the sweep.")]
+        public SweepOrderConfig SweepOrder { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SweepOrder register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SweepOrderConfig GetPayload()
+        {
+            return SweepOrder;
+        }
+
+        /// <summary>
+        /// Creates a message that order of the channels in each pass of the sweep.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SweepOrder register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.SweepOrder.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that order of the channels in each pass of the sweep.
+    /// </summary>
+    [DisplayName("TimestampedSweepOrderPayload")]
+    [Description("Creates a timestamped message payload that order of the channels in each pass of the sweep.")]
+    public partial class CreateTimestampedSweepOrderPayload : CreateSweepOrderPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that order of the channels in each pass of the sweep.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SweepOrder register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.SweepOrder.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that seed of the pseudo-random order of the sweep. The same seed repeats the same order.
+    /// </summary>
+    [DisplayName("SweepSeedPayload")]
+    [Description("Creates a message payload that seed of the pseudo-random order of the sweep. The same seed repeats the same order.")]
+    public partial class CreateSweepSeedPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that seed of the pseudo-random order of the sweep. The same seed repeats the same order.
+        /// </summary>
+        [Description("The value that seed of the pseudo-random order of the sweep. The same seed repeats the same order.")]
+        public ushort SweepSeed { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SweepSeed register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SweepSeed;
+        }
+
+        /// <summary>
+        /// Creates a message that seed of the pseudo-random order of the sweep. The same seed repeats the same order.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SweepSeed register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.SweepSeed.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that seed of the pseudo-random order of the sweep. The same seed repeats the same order.
+    /// </summary>
+    [DisplayName("TimestampedSweepSeedPayload")]
+    [Description("Creates a timestamped message payload that seed of the pseudo-random order of the sweep. The same seed repeats the same order.")]
+    public partial class CreateTimestampedSweepSeedPayload : CreateSweepSeedPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that seed of the pseudo-random order of the sweep. The same seed repeats the same order.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SweepSeed register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.SweepSeed.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of passes through the sweep channels. A value of 0 sweeps until stopped.
+    /// </summary>
+    [DisplayName("SweepRepeatsPayload")]
+    [Description("Creates a message payload that number of passes through the sweep channels. A value of 0 sweeps until stopped.")]
+    public partial class CreateSweepRepeatsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of passes through the sweep channels. A value of 0 sweeps until stopped.
+        /// </summary>
+        [Description("The value that number of passes through the sweep channels. A value of 0 sweeps until stopped.")]
+        public ushort SweepRepeats { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SweepRepeats register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SweepRepeats;
+        }
+
+        /// <summary>
+        /// Creates a message that number of passes through the sweep channels. A value of 0 sweeps until stopped.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SweepRepeats register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.SweepRepeats.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of passes through the sweep channels. A value of 0 sweeps until stopped.
+    /// </summary>
+    [DisplayName("TimestampedSweepRepeatsPayload")]
+    [Description("Creates a timestamped message payload that number of passes through the sweep channels. A value of 0 sweeps until stopped.")]
+    public partial class CreateTimestampedSweepRepeatsPayload : CreateSweepRepeatsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of passes through the sweep channels. A value of 0 sweeps until stopped.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SweepRepeats register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.SweepRepeats.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that starts or stops the sweep. The sweep can only be started when the board is controlled by USB. An event is emitted when the last pass ends and the channels are disabled.
+    /// </summary>
+    [DisplayName("SweepControlPayload")]
+    [Description("Creates a message payload that starts or stops the sweep. The sweep can only be started when the board is controlled by USB. An event is emitted when the last pass ends and the channels are disabled.")]
+    public partial class CreateSweepControlPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that starts or stops the sweep. The sweep can only be started when the board is controlled by USB. An event is emitted when the last pass ends and the channels are disabled.
+        /// </summary>
+        [Description("The value that starts or stops the sweep. The sweep can only be started when the board is controlled by USB. An event is emitted when the last pass ends and the channels are disabled.")]
+        public SweepControlConfig SweepControl { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SweepControl register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SweepControlConfig GetPayload()
+        {
+            return SweepControl;
+        }
+
+        /// <summary>
+        /// Creates a message that starts or stops the sweep. The sweep can only be started when the board is controlled by USB. An event is emitted when the last pass ends and the channels are disabled.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SweepControl register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.SweepControl.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that starts or stops the sweep. The sweep can only be started when the board is controlled by USB. An event is emitted when the last pass ends and the channels are disabled.
+    /// </summary>
+    [DisplayName("TimestampedSweepControlPayload")]
+    [Description("Creates a timestamped message payload that starts or stops the sweep. The sweep can only be started when the board is controlled by USB. An event is emitted when the last pass ends and the channels are disabled.")]
+    public partial class CreateTimestampedSweepControlPayload : CreateSweepControlPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that starts or stops the sweep. The sweep can only be started when the board is controlled by USB. An event is emitted when the last pass ends and the channels are disabled.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SweepControl register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.SweepControl.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that width, in microseconds, of the DO0 pulse emitted on every channel change when DO0 is configured as PulseOnChannelChange. The maximum is 8000 us.
+    /// </summary>
+    [DisplayName("DO0PulseWidthPayload")]
+    [Description("Creates a message payload that width, in microseconds, of the DO0 pulse emitted on every channel change when DO0 is configured as PulseOnChannelChange. The maximum is 8000 us.")]
+    public partial class CreateDO0PulseWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that width, in microseconds, of the DO0 pulse emitted on every channel change when DO0 is configured as PulseOnChannelChange. The maximum is 8000 us.
+        /// </summary>
+        [Description("The value that width, in microseconds, of the DO0 pulse emitted on every channel change when DO0 is configured as PulseOnChannelChange. The maximum is 8000 us.")]
+        public ushort DO0PulseWidth { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0PulseWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO0PulseWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that width, in microseconds, of the DO0 pulse emitted on every channel change when DO0 is configured as PulseOnChannelChange. The maximum is 8000 us.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0PulseWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.DO0PulseWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that width, in microseconds, of the DO0 pulse emitted on every channel change when DO0 is configured as PulseOnChannelChange. The maximum is 8000 us.
+    /// </summary>
+    [DisplayName("TimestampedDO0PulseWidthPayload")]
+    [Description("Creates a timestamped message payload that width, in microseconds, of the DO0 pulse emitted on every channel change when DO0 is configured as PulseOnChannelChange. The maximum is 8000 us.")]
+    public partial class CreateTimestampedDO0PulseWidthPayload : CreateDO0PulseWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that width, in microseconds, of the DO0 pulse emitted on every channel change when DO0 is configured as PulseOnChannelChange. The maximum is 8000 us.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0PulseWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.DO0PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time unit, in microseconds, of the DO0 code emitted on every channel change when DO0 is configured as CodeOnChannelChange. Every symbol lasts 4 units and is high for 3 units (start), 2 units (bit set) or 1 unit (bit cleared). A start symbol is followed by the 16 bits of the new channel mask, LSB first, and by one idle symbol that keeps DO0 low for 4 units so the next code can be found. Valid from 10 to 4000 us.
+    /// </summary>
+    [DisplayName("DO0CodeUnitPayload")]
+    [Description("Creates a message payload that time unit, in microseconds, of the DO0 code emitted on every channel change when DO0 is configured as CodeOnChannelChange. Every symbol lasts 4 units and is high for 3 units (start), 2 units (bit set) or 1 unit (bit cleared). A start symbol is followed by the 16 bits of the new channel mask, LSB first, and by one idle symbol that keeps DO0 low for 4 units so the next code can be found. Valid from 10 to 4000 us.")]
+    public partial class CreateDO0CodeUnitPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time unit, in microseconds, of the DO0 code emitted on every channel change when DO0 is configured as CodeOnChannelChange. Every symbol lasts 4 units and is high for 3 units (start), 2 units (bit set) or 1 unit (bit cleared). A start symbol is followed by the 16 bits of the new channel mask, LSB first, and by one idle symbol that keeps DO0 low for 4 units so the next code can be found. Valid from 10 to 4000 us.
+        /// </summary>
+        [Description("The value that time unit, in microseconds, of the DO0 code emitted on every channel change when DO0 is configured as CodeOnChannelChange. Every symbol lasts 4 units and is high for 3 units (start), 2 units (bit set) or 1 unit (bit cleared). A start symbol is followed by the 16 bits of the new channel mask, LSB first, and by one idle symbol that keeps DO0 low for 4 units so the next code can be found. Valid from 10 to 4000 us.")]
+        public ushort DO0CodeUnit { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0CodeUnit register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO0CodeUnit;
+        }
+
+        /// <summary>
+        /// Creates a message that time unit, in microseconds, of the DO0 code emitted on every channel change when DO0 is configured as CodeOnChannelChange. Every symbol lasts 4 units and is high for 3 units (start), 2 units (bit set) or 1 unit (bit cleared). A start symbol is followed by the 16 bits of the new channel mask, LSB first, and by one idle symbol that keeps DO0 low for 4 units so the next code can be found. Valid from 10 to 4000 us.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0CodeUnit register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.DO0CodeUnit.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time unit, in microseconds, of the DO0 code emitted on every channel change when DO0 is configured as CodeOnChannelChange. Every symbol lasts 4 units and is high for 3 units (start), 2 units (bit set) or 1 unit (bit cleared). A start symbol is followed by the 16 bits of the new channel mask, LSB first, and by one idle symbol that keeps DO0 low for 4 units so the next code can be found. Valid from 10 to 4000 us.
+    /// </summary>
+    [DisplayName("TimestampedDO0CodeUnitPayload")]
+    [Description("Creates a timestamped message payload that time unit, in microseconds, of the DO0 code emitted on every channel change when DO0 is configured as CodeOnChannelChange. Every symbol lasts 4 units and is high for 3 units (start), 2 units (bit set) or 1 unit (bit cleared). A start symbol is followed by the 16 bits of the new channel mask, LSB first, and by one idle symbol that keeps DO0 low for 4 units so the next code can be found. Valid from 10 to 4000 us.")]
+    public partial class CreateTimestampedDO0CodeUnitPayload : CreateDO0CodeUnitPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time unit, in microseconds, of the DO0 code emitted on every channel change when DO0 is configured as CodeOnChannelChange. Every symbol lasts 4 units and is high for 3 units (start), 2 units (bit set) or 1 unit (bit cleared). A start symbol is followed by the 16 bits of the new channel mask, LSB first, and by one idle symbol that keeps DO0 low for 4 units so the next code can be found. Valid from 10 to 4000 us.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0CodeUnit register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.DO0CodeUnit.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time, in microseconds, each digital input must be stable after its last edge before it switches the channels or generates events. Each input is filtered on its own, so a noisy input does not delay the others. A value of 0 disables the filter. The maximum is 16000 us. Writing it clears the DeglitchRejects counters.
+    /// </summary>
+    [DisplayName("DeglitchTimePayload")]
+    [Description("Creates a message payload that time, in microseconds, each digital input must be stable after its last edge before it switches the channels or generates events. Each input is filtered on its own, so a noisy input does not delay the others. A value of 0 disables the filter. The maximum is 16000 us. Writing it clears the DeglitchRejects counters.")]
+    public partial class CreateDeglitchTimePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time, in microseconds, each digital input must be stable after its last edge before it switches the channels or generates events. Each input is filtered on its own, so a noisy input does not delay the others. A value of 0 disables the filter. The maximum is 16000 us. Writing it clears the DeglitchRejects counters.
+        /// </summary>
+        [Description("The value that time, in microseconds, each digital input must be stable after its last edge before it switches the channels or generates events. Each input is filtered on its own, so a noisy input does not delay the others. A value of 0 disables the filter. The maximum is 16000 us. Writing it clears the DeglitchRejects counters.")]
+        public ushort DeglitchTime { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DeglitchTime register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DeglitchTime;
+        }
+
+        /// <summary>
+        /// Creates a message that time, in microseconds, each digital input must be stable after its last edge before it switches the channels or generates events. Each input is filtered on its own, so a noisy input does not delay the others. A value of 0 disables the filter. The maximum is 16000 us. Writing it clears the DeglitchRejects counters.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DeglitchTime register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.DeglitchTime.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time, in microseconds, each digital input must be stable after its last edge before it switches the channels or generates events. Each input is filtered on its own, so a noisy input does not delay the others. A value of 0 disables the filter. The maximum is 16000 us. Writing it clears the DeglitchRejects counters.
+    /// </summary>
+    [DisplayName("TimestampedDeglitchTimePayload")]
+    [Description("Creates a timestamped message payload that time, in microseconds, each digital input must be stable after its last edge before it switches the channels or generates events. Each input is filtered on its own, so a noisy input does not delay the others. A value of 0 disables the filter. The maximum is 16000 us. Writing it clears the DeglitchRejects counters.")]
+    public partial class CreateTimestampedDeglitchTimePayload : CreateDeglitchTimePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time, in microseconds, each digital input must be stable after its last edge before it switches the channels or generates events. Each input is filtered on its own, so a noisy input does not delay the others. A value of 0 disables the filter. The maximum is 16000 us. Writing it clears the DeglitchRejects counters.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DeglitchTime register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.DeglitchTime.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of glitches rejected by the deglitch filter on DI0 to DI4 and ADD, in this order.
+    /// </summary>
+    [DisplayName("DeglitchRejectsPayload")]
+    [Description("Creates a message payload that number of glitches rejected by the deglitch filter on DI0 to DI4 and ADD, in this order.")]
+    public partial class CreateDeglitchRejectsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of glitches rejected by the deglitch filter on DI0 to DI4 and ADD, in this order.
+        /// </summary>
+        [Description("The value that number of glitches rejected by the deglitch filter on DI0 to DI4 and ADD, in this order.")]
+        public ushort[] DeglitchRejects { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DeglitchRejects register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return DeglitchRejects;
+        }
+
+        /// <summary>
+        /// Creates a message that number of glitches rejected by the deglitch filter on DI0 to DI4 and ADD, in this order.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DeglitchRejects register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.DeglitchRejects.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of glitches rejected by the deglitch filter on DI0 to DI4 and ADD, in this order.
+    /// </summary>
+    [DisplayName("TimestampedDeglitchRejectsPayload")]
+    [Description("Creates a timestamped message payload that number of glitches rejected by the deglitch filter on DI0 to DI4 and ADD, in this order.")]
+    public partial class CreateTimestampedDeglitchRejectsPayload : CreateDeglitchRejectsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of glitches rejected by the deglitch filter on DI0 to DI4 and ADD, in this order.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DeglitchRejects register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.DeglitchRejects.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that period, in milliseconds, of the IoState keep-alive sent in Speed Mode when nothing changes. In Speed Mode every change of the channels, digital inputs and DO0 is sent as an IoState event, regardless of EnableEvents and EventCoalesceWindow. A value of 0 disables the keep-alive.
+    /// </summary>
+    [DisplayName("StreamKeepAlivePayload")]
+    [Description("Creates a message payload that period, in milliseconds, of the IoState keep-alive sent in Speed Mode when nothing changes. In Speed Mode every change of the channels, digital inputs and DO0 is sent as an IoState event, regardless of EnableEvents and EventCoalesceWindow. A value of 0 disables the keep-alive.")]
+    public partial class CreateStreamKeepAlivePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that period, in milliseconds, of the IoState keep-alive sent in Speed Mode when nothing changes. In Speed Mode every change of the channels, digital inputs and DO0 is sent as an IoState event, regardless of EnableEvents and EventCoalesceWindow. A value of 0 disables the keep-alive.
+        /// </summary>
+        [Description("The value that period, in milliseconds, of the IoState keep-alive sent in Speed Mode when nothing changes. In Speed Mode every change of the channels, digital inputs and DO0 is sent as an IoState event, regardless of EnableEvents and EventCoalesceWindow. A value of 0 disables the keep-alive.")]
+        public ushort StreamKeepAlive { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the StreamKeepAlive register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return StreamKeepAlive;
+        }
+
+        /// <summary>
+        /// Creates a message that period, in milliseconds, of the IoState keep-alive sent in Speed Mode when nothing changes. In Speed Mode every change of the channels, digital inputs and DO0 is sent as an IoState event, regardless of EnableEvents and EventCoalesceWindow. A value of 0 disables the keep-alive.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the StreamKeepAlive register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.StreamKeepAlive.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that period, in milliseconds, of the IoState keep-alive sent in Speed Mode when nothing changes. In Speed Mode every change of the channels, digital inputs and DO0 is sent as an IoState event, regardless of EnableEvents and EventCoalesceWindow. A value of 0 disables the keep-alive.
+    /// </summary>
+    [DisplayName("TimestampedStreamKeepAlivePayload")]
+    [Description("Creates a timestamped message payload that period, in milliseconds, of the IoState keep-alive sent in Speed Mode when nothing changes. In Speed Mode every change of the channels, digital inputs and DO0 is sent as an IoState event, regardless of EnableEvents and EventCoalesceWindow. A value of 0 disables the keep-alive.")]
+    public partial class CreateTimestampedStreamKeepAlivePayload : CreateStreamKeepAlivePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that period, in milliseconds, of the IoState keep-alive sent in Speed Mode when nothing changes. In Speed Mode every change of the channels, digital inputs and DO0 is sent as an IoState event, regardless of EnableEvents and EventCoalesceWindow. A value of 0 disables the keep-alive.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the StreamKeepAlive register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.StreamKeepAlive.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that ring of the last 16 input edges, two words per edge. The first word is the timestamp second. The second word holds the timestamp microseconds, in 32 us units, in bits 0 to 15, and the state of DI0 to DI4 and ADD after the edge in bits 16 to 21. The unread edges go from EdgeTail up to, but excluding, EdgeHead. Read EdgeHead before EdgeHistory, so that only the edges logged before that read are freed.
+    /// </summary>
+    [DisplayName("EdgeHistoryPayload")]
+    [Description("Creates a message payload that ring of the last 16 input edges, two words per edge. The first word is the timestamp second. The second word holds the timestamp microseconds, in 32 us units, in bits 0 to 15, and the state of DI0 to DI4 and ADD after the edge in bits 16 to 21. The unread edges go from EdgeTail up to, but excluding, EdgeHead. Read EdgeHead before EdgeHistory, so that only the edges logged before that read are freed.")]
+    public partial class CreateEdgeHistoryPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that ring of the last 16 input edges, two words per edge. The first word is the timestamp second. The second word holds the timestamp microseconds, in 32 us units, in bits 0 to 15, and the state of DI0 to DI4 and ADD after the edge in bits 16 to 21. The unread edges go from EdgeTail up to, but excluding, EdgeHead. Read EdgeHead before EdgeHistory, so that only the edges logged before that read are freed.
+        /// </summary>
+        [Description("The value that ring of the last 16 input edges, two words per edge. The first word is the timestamp second. The second word holds the timestamp microseconds, in 32 us units, in bits 0 to 15, and the state of DI0 to DI4 and ADD after the edge in bits 16 to 21. The unread edges go from EdgeTail up to, but excluding, EdgeHead. Read EdgeHead before EdgeHistory, so that only the edges logged before that read are freed.")]
+        public uint[] EdgeHistory { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EdgeHistory register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return EdgeHistory;
+        }
+
+        /// <summary>
+        /// Creates a message that ring of the last 16 input edges, two words per edge. The first word is the timestamp second. The second word holds the timestamp microseconds, in 32 us units, in bits 0 to 15, and the state of DI0 to DI4 and ADD after the edge in bits 16 to 21. The unread edges go from EdgeTail up to, but excluding, EdgeHead. Read EdgeHead before EdgeHistory, so that only the edges logged before that read are freed.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EdgeHistory register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.EdgeHistory.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that ring of the last 16 input edges, two words per edge. The first word is the timestamp second. The second word holds the timestamp microseconds, in 32 us units, in bits 0 to 15, and the state of DI0 to DI4 and ADD after the edge in bits 16 to 21. The unread edges go from EdgeTail up to, but excluding, EdgeHead. Read EdgeHead before EdgeHistory, so that only the edges logged before that read are freed.
+    /// </summary>
+    [DisplayName("TimestampedEdgeHistoryPayload")]
+    [Description("Creates a timestamped message payload that ring of the last 16 input edges, two words per edge. The first word is the timestamp second. The second word holds the timestamp microseconds, in 32 us units, in bits 0 to 15, and the state of DI0 to DI4 and ADD after the edge in bits 16 to 21. The unread edges go from EdgeTail up to, but excluding, EdgeHead. Read EdgeHead before EdgeHistory, so that only the edges logged before that read are freed.")]
+    public partial class CreateTimestampedEdgeHistoryPayload : CreateEdgeHistoryPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that ring of the last 16 input edges, two words per edge. The first word is the timestamp second. The second word holds the timestamp microseconds, in 32 us units, in bits 0 to 15, and the state of DI0 to DI4 and ADD after the edge in bits 16 to 21. The unread edges go from EdgeTail up to, but excluding, EdgeHead. Read EdgeHead before EdgeHistory, so that only the edges logged before that read are freed.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EdgeHistory register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.EdgeHistory.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that bits 0 to 3 are the entry written by the next input edge. Bit 7 is set when edges were dropped because the ring was full, and is cleared by a write to EdgeTail.
+    /// </summary>
+    [DisplayName("EdgeHeadPayload")]
+    [Description("Creates a message payload that bits 0 to 3 are the entry written by the next input edge. Bit 7 is set when edges were dropped because the ring was full, and is cleared by a write to EdgeTail.")]
+    public partial class CreateEdgeHeadPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that bits 0 to 3 are the entry written by the next input edge. Bit 7 is set when edges were dropped because the ring was full, and is cleared by a write to EdgeTail.
+        /// </summary>
+        [Description("The value that bits 0 to 3 are the entry written by the next input edge. Bit 7 is set when edges were dropped because the ring was full, and is cleared by a write to EdgeTail.")]
+        public byte EdgeHead { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EdgeHead register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return EdgeHead;
+        }
+
+        /// <summary>
+        /// Creates a message that bits 0 to 3 are the entry written by the next input edge. Bit 7 is set when edges were dropped because the ring was full, and is cleared by a write to EdgeTail.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EdgeHead register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.EdgeHead.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that bits 0 to 3 are the entry written by the next input edge. Bit 7 is set when edges were dropped because the ring was full, and is cleared by a write to EdgeTail.
+    /// </summary>
+    [DisplayName("TimestampedEdgeHeadPayload")]
+    [Description("Creates a timestamped message payload that bits 0 to 3 are the entry written by the next input edge. Bit 7 is set when edges were dropped because the ring was full, and is cleared by a write to EdgeTail.")]
+    public partial class CreateTimestampedEdgeHeadPayload : CreateEdgeHeadPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that bits 0 to 3 are the entry written by the next input edge. Bit 7 is set when edges were dropped because the ring was full, and is cleared by a write to EdgeTail.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EdgeHead register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.EdgeHead.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that first entry of EdgeHistory not read yet (0 to 15). Read EdgeHead first, then EdgeHistory, and write bits 0 to 3 of that EdgeHead value to free the entries read. Edges logged after the read of EdgeHead stay in the ring.
+    /// </summary>
+    [DisplayName("EdgeTailPayload")]
+    [Description("Creates a message payload that first entry of EdgeHistory not read yet (0 to 15). Read EdgeHead first, then EdgeHistory, and write bits 0 to 3 of that EdgeHead value to free the entries read. Edges logged after the read of EdgeHead stay in the ring.")]
+    public partial class CreateEdgeTailPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that first entry of EdgeHistory not read yet (0 to 15). Read EdgeHead first, then EdgeHistory, and write bits 0 to 3 of that EdgeHead value to free the entries read. Edges logged after the read of EdgeHead stay in the ring.
+        /// </summary>
+        [Description("The value that first entry of EdgeHistory not read yet (0 to 15). Read EdgeHead first, then EdgeHistory, and write bits 0 to 3 of that EdgeHead value to free the entries read. Edges logged after the read of EdgeHead stay in the ring.")]
+        public byte EdgeTail { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EdgeTail register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return EdgeTail;
+        }
+
+        /// <summary>
+        /// Creates a message that first entry of EdgeHistory not read yet (0 to 15). Read EdgeHead first, then EdgeHistory, and write bits 0 to 3 of that EdgeHead value to free the entries read. Edges logged after the read of EdgeHead stay in the ring.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EdgeTail register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.EdgeTail.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that first entry of EdgeHistory not read yet (0 to 15). Read EdgeHead first, then EdgeHistory, and write bits 0 to 3 of that EdgeHead value to free the entries read. Edges logged after the read of EdgeHead stay in the ring.
+    /// </summary>
+    [DisplayName("TimestampedEdgeTailPayload")]
+    [Description("Creates a timestamped message payload that first entry of EdgeHistory not read yet (0 to 15). Read EdgeHead first, then EdgeHistory, and write bits 0 to 3 of that EdgeHead value to free the entries read. Edges logged after the read of EdgeHead stay in the ring.")]
+    public partial class CreateTimestampedEdgeTailPayload : CreateEdgeTailPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that first entry of EdgeHistory not read yet (0 to 15). Read EdgeHead first, then EdgeHistory, and write bits 0 to 3 of that EdgeHead value to free the entries read. Edges logged after the read of EdgeHead stay in the ring.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EdgeTail register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.EdgeTail.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that histogram of the time from the digital input interrupt to the write of the audio channels, including the deglitch time. Bin n counts the switches that took from 2^(n-1) to 2^n - 1 ticks of 0.25 us, bin 0 the ones under one tick and bin 15 the ones of 2^14 ticks or more. The counts saturate at 65535.
+    /// </summary>
+    [DisplayName("LatencyExternalPayload")]
+    [Description("Creates a message payload that histogram of the time from the digital input interrupt to the write of the audio channels, including the deglitch time. Bin n counts the switches that took from 2^(n-1) to 2^n - 1 ticks of 0.25 us, bin 0 the ones under one tick and bin 15 the ones of 2^14 ticks or more. The counts saturate at 65535.")]
+    public partial class CreateLatencyExternalPayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Gets or sets the value that histogram of the time from the digital input interrupt to the write of the audio channels, including the deglitch time. Bin n counts the switches that took from 2^(n-1) to 2^n - 1 ticks of 0.25 us, bin 0 the ones under one tick and bin 15 the ones of 2^14 ticks or more. The counts saturate at 65535.
         /// </summary>
-        public CreateMessage()
+        [Description("The value that histogram of the time from the digital input interrupt to the write of the audio channels, including the deglitch time. Bin n counts the switches that took from 2^(n-1) to 2^n - 1 ticks of 0.25 us, bin 0 the ones under one tick and bin 15 the ones of 2^14 ticks or more. The counts saturate at 65535.")]
+        public ushort[] LatencyExternal { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the LatencyExternal register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
         {
-            Payload = new CreateControlModePayload();
+            return LatencyExternal;
         }
 
-        string INamedElement.Name => $"{nameof(AudioSwitch)}.{GetElementDisplayName(Payload)}";
+        /// <summary>
+        /// Creates a message that histogram of the time from the digital input interrupt to the write of the audio channels, including the deglitch time. Bin n counts the switches that took from 2^(n-1) to 2^n - 1 ticks of 0.25 us, bin 0 the ones under one tick and bin 15 the ones of 2^14 ticks or more. The counts saturate at 65535.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the LatencyExternal register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.LatencyExternal.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that histogram of the time from the digital input interrupt to the write of the audio channels, including the deglitch time. Bin n counts the switches that took from 2^(n-1) to 2^n - 1 ticks of 0.25 us, bin 0 the ones under one tick and bin 15 the ones of 2^14 ticks or more. The counts saturate at 65535.
+    /// </summary>
+    [DisplayName("TimestampedLatencyExternalPayload")]
+    [Description("Creates a timestamped message payload that histogram of the time from the digital input interrupt to the write of the audio channels, including the deglitch time. Bin n counts the switches that took from 2^(n-1) to 2^n - 1 ticks of 0.25 us, bin 0 the ones under one tick and bin 15 the ones of 2^14 ticks or more. The counts saturate at 65535.")]
+    public partial class CreateTimestampedLatencyExternalPayload : CreateLatencyExternalPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that histogram of the time from the digital input interrupt to the write of the audio channels, including the deglitch time. Bin n counts the switches that took from 2^(n-1) to 2^n - 1 ticks of 0.25 us, bin 0 the ones under one tick and bin 15 the ones of 2^14 ticks or more. The counts saturate at 65535.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the LatencyExternal register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.LatencyExternal.FromPayload(timestamp, messageType, GetPayload());
+        }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures the source to enable the board channels.
+    /// that histogram of the time from the dispatch of a host write to the write of the audio channels, with the same bins as LatencyExternal.
     /// </summary>
-    [DisplayName("ControlModePayload")]
-    [Description("Creates a message payload that configures the source to enable the board channels.")]
-    public partial class CreateControlModePayload
+    [DisplayName("LatencyUsbPayload")]
+    [Description("Creates a message payload that histogram of the time from the dispatch of a host write to the write of the audio channels, with the same bins as LatencyExternal.")]
+    public partial class CreateLatencyUsbPayload
     {
         /// <summary>
-        /// Gets or sets the value that configures the source to enable the board channels.
+        /// Gets or sets the value that histogram of the time from the dispatch of a host write to the write of the audio channels, with the same bins as LatencyExternal.
         /// </summary>
-        [Description("The value that configures the source to enable the board channels.")]
-        public ControlSource ControlMode { get; set; }
+        [Description("The value that histogram of the time from the dispatch of a host write to the write of the audio channels, with the same bins as LatencyExternal.")]
+        public ushort[] LatencyUsb { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the ControlMode register.
+        /// Creates a message payload for the LatencyUsb register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ControlSource GetPayload()
+        public ushort[] GetPayload()
         {
-            return ControlMode;
+            return LatencyUsb;
         }
 
         /// <summary>
-        /// Creates a message that configures the source to enable the board channels.
+        /// Creates a message that histogram of the time from the dispatch of a host write to the write of the audio channels, with the same bins as LatencyExternal.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ControlMode register.</returns>
+        /// <returns>A new message for the LatencyUsb register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AudioSwitch.ControlMode.FromPayload(messageType, GetPayload());
+            return Harp.AudioSwitch.LatencyUsb.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures the source to enable the board channels.
+    /// that histogram of the time from the dispatch of a host write to the write of the audio channels, with the same bins as LatencyExternal.
     /// </summary>
-    [DisplayName("TimestampedControlModePayload")]
-    [Description("Creates a timestamped message payload that configures the source to enable the board channels.")]
-    public partial class CreateTimestampedControlModePayload : CreateControlModePayload
+    [DisplayName("TimestampedLatencyUsbPayload")]
+    [Description("Creates a timestamped message payload that histogram of the time from the dispatch of a host write to the write of the audio channels, with the same bins as LatencyExternal.")]
+    public partial class CreateTimestampedLatencyUsbPayload : CreateLatencyUsbPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures the source to enable the board channels.
+        /// Creates a timestamped message that histogram of the time from the dispatch of a host write to the write of the audio channels, with the same bins as LatencyExternal.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ControlMode register.</returns>
+        /// <returns>A new timestamped message for the LatencyUsb register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AudioSwitch.ControlMode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AudioSwitch.LatencyUsb.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.
+    /// that clears the selected latency histograms.
     /// </summary>
-    [DisplayName("EnableChannelsPayload")]
-    [Description("Creates a message payload that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.")]
-    public partial class CreateEnableChannelsPayload
+    [DisplayName("LatencyClearPayload")]
+    [Description("Creates a message payload that clears the selected latency histograms.")]
+    public partial class CreateLatencyClearPayload
     {
         /// <summary>
-        /// Gets or sets the value that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.
+        /// Gets or sets the value that clears the selected latency histograms.
         /// </summary>
-        [Description("The value that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.")]
-        public AudioChannels EnableChannels { get; set; }
+        [Description("The value that clears the selected latency histograms.")]
+        public LatencyClearFlags LatencyClear { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EnableChannels register.
+        /// Creates a message payload for the LatencyClear register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public AudioChannels GetPayload()
+        public LatencyClearFlags GetPayload()
         {
-            return EnableChannels;
+            return LatencyClear;
         }
 
         /// <summary>
-        /// Creates a message that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.
+        /// Creates a message that clears the selected latency histograms.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableChannels register.</returns>
+        /// <returns>A new message for the LatencyClear register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AudioSwitch.EnableChannels.FromPayload(messageType, GetPayload());
+            return Harp.AudioSwitch.LatencyClear.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.
+    /// that clears the selected latency histograms.
     /// </summary>
-    [DisplayName("TimestampedEnableChannelsPayload")]
-    [Description("Creates a timestamped message payload that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.")]
-    public partial class CreateTimestampedEnableChannelsPayload : CreateEnableChannelsPayload
+    [DisplayName("TimestampedLatencyClearPayload")]
+    [Description("Creates a timestamped message payload that clears the selected latency histograms.")]
+    public partial class CreateTimestampedLatencyClearPayload : CreateLatencyClearPayload
     {
         /// <summary>
-        /// Creates a timestamped message that enables the audio output channels using a bitmask format. An event will be emitted when any of the channels are enabled.
+        /// Creates a timestamped message that clears the selected latency histograms.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableChannels register.</returns>
+        /// <returns>A new timestamped message for the LatencyClear register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AudioSwitch.EnableChannels.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AudioSwitch.LatencyClear.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+    /// that number of times each audio channel was enabled since the last reset.
     /// </summary>
-    [DisplayName("DigitalInputStatePayload")]
-    [Description("Creates a message payload that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.")]
-    public partial class CreateDigitalInputStatePayload
+    [DisplayName("ChannelActivationsPayload")]
+    [Description("Creates a message payload that number of times each audio channel was enabled since the last reset.")]
+    public partial class CreateChannelActivationsPayload
     {
         /// <summary>
-        /// Gets or sets the value that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+        /// Gets or sets the value that number of times each audio channel was enabled since the last reset.
         /// </summary>
-        [Description("The value that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.")]
-        public DigitalInputs DigitalInputState { get; set; }
+        [Description("The value that number of times each audio channel was enabled since the last reset.")]
+        public uint[] ChannelActivations { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalInputState register.
+        /// Creates a message payload for the ChannelActivations register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalInputs GetPayload()
+        public uint[] GetPayload()
         {
-            return DigitalInputState;
+            return ChannelActivations;
         }
 
         /// <summary>
-        /// Creates a message that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+        /// Creates a message that number of times each audio channel was enabled since the last reset.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalInputState register.</returns>
+        /// <returns>A new message for the ChannelActivations register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AudioSwitch.DigitalInputState.FromPayload(messageType, GetPayload());
+            return Harp.AudioSwitch.ChannelActivations.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+    /// that number of times each audio channel was enabled since the last reset.
     /// </summary>
-    [DisplayName("TimestampedDigitalInputStatePayload")]
-    [Description("Creates a timestamped message payload that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.")]
-    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    [DisplayName("TimestampedChannelActivationsPayload")]
+    [Description("Creates a timestamped message payload that number of times each audio channel was enabled since the last reset.")]
+    public partial class CreateTimestampedChannelActivationsPayload : CreateChannelActivationsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+        /// Creates a timestamped message that number of times each audio channel was enabled since the last reset.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        /// <returns>A new timestamped message for the ChannelActivations register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AudioSwitch.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AudioSwitch.ChannelActivations.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that status of the digital output pin 0.
+    /// that time, in milliseconds, each audio channel was enabled since the last reset.
     /// </summary>
-    [DisplayName("DO0StatePayload")]
-    [Description("Creates a message payload that status of the digital output pin 0.")]
-    public partial class CreateDO0StatePayload
+    [DisplayName("ChannelOnTimePayload")]
+    [Description("Creates a message payload that time, in milliseconds, each audio channel was enabled since the last reset.")]
+    public partial class CreateChannelOnTimePayload
     {
         /// <summary>
-        /// Gets or sets the value that status of the digital output pin 0.
+        /// Gets or sets the value that time, in milliseconds, each audio channel was enabled since the last reset.
         /// </summary>
-        [Description("The value that status of the digital output pin 0.")]
-        public EnableFlag DO0State { get; set; }
+        [Description("The value that time, in milliseconds, each audio channel was enabled since the last reset.")]
+        public uint[] ChannelOnTime { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO0State register.
+        /// Creates a message payload for the ChannelOnTime register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public EnableFlag GetPayload()
+        public uint[] GetPayload()
         {
-            return DO0State;
+            return ChannelOnTime;
         }
 
         /// <summary>
-        /// Creates a message that status of the digital output pin 0.
+        /// Creates a message that time, in milliseconds, each audio channel was enabled since the last reset.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0State register.</returns>
+        /// <returns>A new message for the ChannelOnTime register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AudioSwitch.DO0State.FromPayload(messageType, GetPayload());
+            return Harp.AudioSwitch.ChannelOnTime.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that status of the digital output pin 0.
+    /// that time, in milliseconds, each audio channel was enabled since the last reset.
     /// </summary>
-    [DisplayName("TimestampedDO0StatePayload")]
-    [Description("Creates a timestamped message payload that status of the digital output pin 0.")]
-    public partial class CreateTimestampedDO0StatePayload : CreateDO0StatePayload
+    [DisplayName("TimestampedChannelOnTimePayload")]
+    [Description("Creates a timestamped message payload that time, in milliseconds, each audio channel was enabled since the last reset.")]
+    public partial class CreateTimestampedChannelOnTimePayload : CreateChannelOnTimePayload
     {
         /// <summary>
-        /// Creates a timestamped message that status of the digital output pin 0.
+        /// Creates a timestamped message that time, in milliseconds, each audio channel was enabled since the last reset.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0State register.</returns>
+        /// <returns>A new timestamped message for the ChannelOnTime register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AudioSwitch.DO0State.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AudioSwitch.ChannelOnTime.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configuration of the digital input pin 4 functionality.
+    /// that number of channel switches (first element) and digital input changes (second element) not reported because their event is disabled in EnableEvents. Not counted in Standby Mode.
     /// </summary>
-    [DisplayName("DI4TriggerPayload")]
-    [Description("Creates a message payload that configuration of the digital input pin 4 functionality.")]
-    public partial class CreateDI4TriggerPayload
+    [DisplayName("EventsSuppressedPayload")]
+    [Description("Creates a message payload that number of channel switches (first element) and digital input changes (second element) not reported because their event is disabled in EnableEvents. Not counted in Standby Mode.")]
+    public partial class CreateEventsSuppressedPayload
     {
         /// <summary>
-        /// Gets or sets the value that configuration of the digital input pin 4 functionality.
+        /// Gets or sets the value that number of channel switches (first element) and digital input changes (second element) not reported because their event is disabled in EnableEvents. Not counted in Standby Mode.
         /// </summary>
-        [Description("The value that configuration of the digital input pin 4 functionality.")]
-        public DI4TriggerConfig DI4Trigger { get; set; }
+        [Description("The value that number of channel switches (first element) and digital input changes (second element) not reported because their event is disabled in EnableEvents. Not counted in Standby Mode.")]
+        public ushort[] EventsSuppressed { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DI4Trigger register.
+        /// Creates a message payload for the EventsSuppressed register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DI4TriggerConfig GetPayload()
+        public ushort[] GetPayload()
         {
-            return DI4Trigger;
+            return EventsSuppressed;
         }
 
         /// <summary>
-        /// Creates a message that configuration of the digital input pin 4 functionality.
+        /// Creates a message that number of channel switches (first element) and digital input changes (second element) not reported because their event is disabled in EnableEvents. Not counted in Standby Mode.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DI4Trigger register.</returns>
+        /// <returns>A new message for the EventsSuppressed register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AudioSwitch.DI4Trigger.FromPayload(messageType, GetPayload());
+            return Harp.AudioSwitch.EventsSuppressed.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configuration of the digital input pin 4 functionality.
+    /// that number of channel switches (first element) and digital input changes (second element) not reported because their event is disabled in EnableEvents. Not counted in Standby Mode.
     /// </summary>
-    [DisplayName("TimestampedDI4TriggerPayload")]
-    [Description("Creates a timestamped message payload that configuration of the digital input pin 4 functionality.")]
-    public partial class CreateTimestampedDI4TriggerPayload : CreateDI4TriggerPayload
+    [DisplayName("TimestampedEventsSuppressedPayload")]
+    [Description("Creates a timestamped message payload that number of channel switches (first element) and digital input changes (second element) not reported because their event is disabled in EnableEvents. Not counted in Standby Mode.")]
+    public partial class CreateTimestampedEventsSuppressedPayload : CreateEventsSuppressedPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configuration of the digital input pin 4 functionality.
+        /// Creates a timestamped message that number of channel switches (first element) and digital input changes (second element) not reported because their event is disabled in EnableEvents. Not counted in Standby Mode.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DI4Trigger register.</returns>
+        /// <returns>A new timestamped message for the EventsSuppressed register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AudioSwitch.DI4Trigger.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AudioSwitch.EventsSuppressed.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configuration of the digital output pin 0 functionality.
+    /// that number of channel switches caused by the digital inputs, the sequence, the sweep or the channel set/clear/toggle registers that were not reported by an event. The event may be disabled, the device may be in Standby Mode, or the event queue may be full.
     /// </summary>
-    [DisplayName("DO0SyncPayload")]
-    [Description("Creates a message payload that configuration of the digital output pin 0 functionality.")]
-    public partial class CreateDO0SyncPayload
+    [DisplayName("SilentSwitchesPayload")]
+    [Description("Creates a message payload that number of channel switches caused by the digital inputs, the sequence, the sweep or the channel set/clear/toggle registers that were not reported by an event. The event may be disabled, the device may be in Standby Mode, or the event queue may be full.")]
+    public partial class CreateSilentSwitchesPayload
     {
         /// <summary>
-        /// Gets or sets the value that configuration of the digital output pin 0 functionality.
+        /// Gets or sets the value that number of channel switches caused by the digital inputs, the sequence, the sweep or the channel set/clear/toggle registers that were not reported by an event. The event may be disabled, the device may be in Standby Mode, or the event queue may be full.
         /// </summary>
-        [Description("The value that configuration of the digital output pin 0 functionality.")]
-        public DO0SyncConfig DO0Sync { get; set; }
+        [Description("The value that number of channel switches caused by the digital inputs, the sequence, the sweep or the channel set/clear/toggle registers that were not reported by an event. The event may be disabled, the device may be in Standby Mode, or the event queue may be full.")]
+        public ushort SilentSwitches { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO0Sync register.
+        /// Creates a message payload for the SilentSwitches register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DO0SyncConfig GetPayload()
+        public ushort GetPayload()
         {
-            return DO0Sync;
+            return SilentSwitches;
         }
 
         /// <summary>
-        /// Creates a message that configuration of the digital output pin 0 functionality.
+        /// Creates a message that number of channel switches caused by the digital inputs, the sequence, the sweep or the channel set/clear/toggle registers that were not reported by an event. The event may be disabled, the device may be in Standby Mode, or the event queue may be full.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0Sync register.</returns>
+        /// <returns>A new message for the SilentSwitches register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AudioSwitch.DO0Sync.FromPayload(messageType, GetPayload());
+            return Harp.AudioSwitch.SilentSwitches.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configuration of the digital output pin 0 functionality.
+    /// that number of channel switches caused by the digital inputs, the sequence, the sweep or the channel set/clear/toggle registers that were not reported by an event. The event may be disabled, the device may be in Standby Mode, or the event queue may be full.
     /// </summary>
-    [DisplayName("TimestampedDO0SyncPayload")]
-    [Description("Creates a timestamped message payload that configuration of the digital output pin 0 functionality.")]
-    public partial class CreateTimestampedDO0SyncPayload : CreateDO0SyncPayload
+    [DisplayName("TimestampedSilentSwitchesPayload")]
+    [Description("Creates a timestamped message payload that number of channel switches caused by the digital inputs, the sequence, the sweep or the channel set/clear/toggle registers that were not reported by an event. The event may be disabled, the device may be in Standby Mode, or the event queue may be full.")]
+    public partial class CreateTimestampedSilentSwitchesPayload : CreateSilentSwitchesPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configuration of the digital output pin 0 functionality.
+        /// Creates a timestamped message that number of channel switches caused by the digital inputs, the sequence, the sweep or the channel set/clear/toggle registers that were not reported by an event. The event may be disabled, the device may be in Standby Mode, or the event queue may be full.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0Sync register.</returns>
+        /// <returns>A new timestamped message for the SilentSwitches register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AudioSwitch.DO0Sync.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AudioSwitch.SilentSwitches.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that specifies the active events in the device.
+    /// that registers 32 to 39 read at the same instant, in address order. The bytes are ControlMode, EnableChannels (low byte, high byte), DigitalInputState, DO0State, Reserved0, DI4Trigger, DO0Sync and EnableEvents.
     /// </summary>
-    [DisplayName("EnableEventsPayload")]
-    [Description("Creates a message payload that specifies the active events in the device.")]
-    public partial class CreateEnableEventsPayload
+    [DisplayName("SnapshotPayload")]
+    [Description("Creates a message payload that registers 32 to 39 read at the same instant, in address order. The bytes are ControlMode, EnableChannels (low byte, high byte), DigitalInputState, DO0State, Reserved0, DI4Trigger, DO0Sync and EnableEvents.")]
+    public partial class CreateSnapshotPayload
     {
         /// <summary>
-        /// Gets or sets the value that specifies the active events in the device.
+        /// Gets or sets the value that registers 32 to 39 read at the same instant, in address order. The bytes are ControlMode, EnableChannels (low byte, high byte), DigitalInputState, DO0State, Reserved0, DI4Trigger, DO0Sync and EnableEvents.
         /// </summary>
-        [Description("The value that specifies the active events in the device.")]
-        public AudioSwitchEvents EnableEvents { get; set; }
+        [Description("The value that registers 32 to 39 read at the same instant, in address order. The bytes are ControlMode, EnableChannels (low byte, high byte), DigitalInputState, DO0State, Reserved0, DI4Trigger, DO0Sync and EnableEvents.")]
+        public byte[] Snapshot { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EnableEvents register.
+        /// Creates a message payload for the Snapshot register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public AudioSwitchEvents GetPayload()
+        public byte[] GetPayload()
         {
-            return EnableEvents;
+            return Snapshot;
         }
 
         /// <summary>
-        /// Creates a message that specifies the active events in the device.
+        /// Creates a message that registers 32 to 39 read at the same instant, in address order. The bytes are ControlMode, EnableChannels (low byte, high byte), DigitalInputState, DO0State, Reserved0, DI4Trigger, DO0Sync and EnableEvents.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableEvents register.</returns>
+        /// <returns>A new message for the Snapshot register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.AudioSwitch.EnableEvents.FromPayload(messageType, GetPayload());
+            return Harp.AudioSwitch.Snapshot.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that specifies the active events in the device.
+    /// that registers 32 to 39 read at the same instant, in address order. The bytes are ControlMode, EnableChannels (low byte, high byte), DigitalInputState, DO0State, Reserved0, DI4Trigger, DO0Sync and EnableEvents.
     /// </summary>
-    [DisplayName("TimestampedEnableEventsPayload")]
-    [Description("Creates a timestamped message payload that specifies the active events in the device.")]
-    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
+    [DisplayName("TimestampedSnapshotPayload")]
+    [Description("Creates a timestamped message payload that registers 32 to 39 read at the same instant, in address order. The bytes are ControlMode, EnableChannels (low byte, high byte), DigitalInputState, DO0State, Reserved0, DI4Trigger, DO0Sync and EnableEvents.")]
+    public partial class CreateTimestampedSnapshotPayload : CreateSnapshotPayload
     {
         /// <summary>
-        /// Creates a timestamped message that specifies the active events in the device.
+        /// Creates a timestamped message that registers 32 to 39 read at the same instant, in address order. The bytes are ControlMode, EnableChannels (low byte, high byte), DigitalInputState, DO0State, Reserved0, DI4Trigger, DO0Sync and EnableEvents.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableEvents register.</returns>
+        /// <returns>A new timestamped message for the Snapshot register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.AudioSwitch.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.AudioSwitch.Snapshot.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that cRC-16 (CCITT, initial value 0xFFFF) of the configuration registers, recomputed outside interrupt context shortly after every write. Covers ControlMode, DI4Trigger, DO0Sync, EnableEvents, SwitchPolicy, SwitchDeadTime, InputsPriority, EventCoalesceWindow, Presets, GateInputs, the sweep configuration (SweepChannels, SweepDwell, SweepOrder, SweepSeed, SweepRepeats), DO0PulseWidth, DO0CodeUnit, DeglitchTime and StreamKeepAlive. A host can skip writing the configuration when the value matches the one it last read.
+    /// </summary>
+    [DisplayName("ConfigCrcPayload")]
+    [Description("Creates a message payload that cRC-16 (CCITT, initial value 0xFFFF) of the configuration registers, recomputed outside interrupt context shortly after every write. Covers ControlMode, DI4Trigger, DO0Sync, EnableEvents, SwitchPolicy, SwitchDeadTime, InputsPriority, EventCoalesceWindow, Presets, GateInputs, the sweep configuration (SweepChannels, SweepDwell, SweepOrder, SweepSeed, SweepRepeats), DO0PulseWidth, DO0CodeUnit, DeglitchTime and StreamKeepAlive. A host can skip writing the configuration when the value matches the one it last read.")]
+    public partial class CreateConfigCrcPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that cRC-16 (CCITT, initial value 0xFFFF) of the configuration registers, recomputed outside interrupt context shortly after every write. Covers ControlMode, DI4Trigger, DO0Sync, EnableEvents, SwitchPolicy, SwitchDeadTime, InputsPriority, EventCoalesceWindow, Presets, GateInputs, the sweep configuration (SweepChannels, SweepDwell, SweepOrder, SweepSeed, SweepRepeats), DO0PulseWidth, DO0CodeUnit, DeglitchTime and StreamKeepAlive. A host can skip writing the configuration when the value matches the one it last read.
+        /// </summary>
+        [Description("The value that cRC-16 (CCITT, initial value 0xFFFF) of the configuration registers, recomputed outside interrupt context shortly after every write. Covers ControlMode, DI4Trigger, DO0Sync, EnableEvents, SwitchPolicy, SwitchDeadTime, InputsPriority, EventCoalesceWindow, Presets, GateInputs, the sweep configuration (SweepChannels, SweepDwell, SweepOrder, SweepSeed, SweepRepeats), DO0PulseWidth, DO0CodeUnit, DeglitchTime and StreamKeepAlive. A host can skip writing the configuration when the value matches the one it last read.")]
+        public ushort ConfigCrc { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ConfigCrc register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return ConfigCrc;
+        }
+
+        /// <summary>
+        /// Creates a message that cRC-16 (CCITT, initial value 0xFFFF) of the configuration registers, recomputed outside interrupt context shortly after every write. Covers ControlMode, DI4Trigger, DO0Sync, EnableEvents, SwitchPolicy, SwitchDeadTime, InputsPriority, EventCoalesceWindow, Presets, GateInputs, the sweep configuration (SweepChannels, SweepDwell, SweepOrder, SweepSeed, SweepRepeats), DO0PulseWidth, DO0CodeUnit, DeglitchTime and StreamKeepAlive. A host can skip writing the configuration when the value matches the one it last read.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ConfigCrc register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.AudioSwitch.ConfigCrc.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that cRC-16 (CCITT, initial value 0xFFFF) of the configuration registers, recomputed outside interrupt context shortly after every write. Covers ControlMode, DI4Trigger, DO0Sync, EnableEvents, SwitchPolicy, SwitchDeadTime, InputsPriority, EventCoalesceWindow, Presets, GateInputs, the sweep configuration (SweepChannels, SweepDwell, SweepOrder, SweepSeed, SweepRepeats), DO0PulseWidth, DO0CodeUnit, DeglitchTime and StreamKeepAlive. A host can skip writing the configuration when the value matches the one it last read.
+    /// </summary>
+    [DisplayName("TimestampedConfigCrcPayload")]
+    [Description("Creates a timestamped message payload that cRC-16 (CCITT, initial value 0xFFFF) of the configuration registers, recomputed outside interrupt context shortly after every write. Covers ControlMode, DI4Trigger, DO0Sync, EnableEvents, SwitchPolicy, SwitchDeadTime, InputsPriority, EventCoalesceWindow, Presets, GateInputs, the sweep configuration (SweepChannels, SweepDwell, SweepOrder, SweepSeed, SweepRepeats), DO0PulseWidth, DO0CodeUnit, DeglitchTime and StreamKeepAlive. A host can skip writing the configuration when the value matches the one it last read.")]
+    public partial class CreateTimestampedConfigCrcPayload : CreateConfigCrcPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that cRC-16 (CCITT, initial value 0xFFFF) of the configuration registers, recomputed outside interrupt context shortly after every write. Covers ControlMode, DI4Trigger, DO0Sync, EnableEvents, SwitchPolicy, SwitchDeadTime, InputsPriority, EventCoalesceWindow, Presets, GateInputs, the sweep configuration (SweepChannels, SweepDwell, SweepOrder, SweepSeed, SweepRepeats), DO0PulseWidth, DO0CodeUnit, DeglitchTime and StreamKeepAlive. A host can skip writing the configuration when the value matches the one it last read.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ConfigCrc register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.AudioSwitch.ConfigCrc.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
@@ -1375,7 +7988,20 @@ namespace Harp.AudioSwitch
     {
         None = 0x0,
         EnableChannels = 0x1,
-        DigitalInputsState = 0x2
+        DigitalInputsState = 0x2,
+        IoState = 0x4,
+        CoalescedEdges = 0x8
+    }
+
+    /// <summary>
+    /// The latency histograms that can be cleared.
+    /// </summary>
+    [Flags]
+    public enum LatencyClearFlags : byte
+    {
+        None = 0x0,
+        External = 0x1,
+        Usb = 0x2
     }
 
     /// <summary>
@@ -1384,7 +8010,9 @@ namespace Harp.AudioSwitch
     public enum ControlSource : byte
     {
         USB = 0,
-        DigitalInputs = 1
+        DigitalInputs = 1,
+        DigitalInputsPresets = 2,
+        GatedUSB = 3
     }
 
     /// <summary>
@@ -1402,6 +8030,55 @@ namespace Harp.AudioSwitch
     public enum DO0SyncConfig : byte
     {
         Output = 0,
-        ToggleOnChannelChange = 1
+        ToggleOnChannelChange = 1,
+        PulseOnChannelChange = 2,
+        CodeOnChannelChange = 3
+    }
+
+    /// <summary>
+    /// Available policies to commit a new channel mask to the audio output channels.
+    /// </summary>
+    public enum SwitchPolicyConfig : byte
+    {
+        Simultaneous = 0,
+        BreakBeforeMake = 1
+    }
+
+    /// <summary>
+    /// Available interrupt priorities of the digital inputs.
+    /// </summary>
+    public enum InputsPriorityConfig : byte
+    {
+        Low = 0,
+        Medium = 1,
+        High = 2
+    }
+
+    /// <summary>
+    /// Available commands of the channel sequence table.
+    /// </summary>
+    public enum SequenceControlConfig : byte
+    {
+        Stop = 0,
+        Start = 1,
+        Clear = 2
+    }
+
+    /// <summary>
+    /// Available orders of the channels in a sweep.
+    /// </summary>
+    public enum SweepOrderConfig : byte
+    {
+        Sequential = 0,
+        Random = 1
+    }
+
+    /// <summary>
+    /// Available commands of the channel sweep.
+    /// </summary>
+    public enum SweepControlConfig : byte
+    {
+        Stop = 0,
+        Start = 1
     }
 }